@@ -18,6 +18,8 @@
 #include "Kvantum.h"
 
 #include <QDir>
+#include <QFileInfo>
+#include <QCache>
 #include <QPainter>
 #include <QSettings>
 #include <QTimer>
@@ -73,25 +75,32 @@
 #define LIMITED_EXPANSION 14 // when the frame expansion should be limited
 #define MIN_CONTRAST_RATIO 3.5
 
-#define OPACITY_STEP 20 // percent
+#define OPACITY_STEP 20 // percent per ANIMATION_FRAME
+#define PROGRESS_PIXEL_TIME 25 // the time (in ms) of advancing busy progress bars by one pixel
 
 namespace Kvantum
 {
 
+/* The linear values of 8-bit sRGB components (see luminance) */
+static const qreal *linearRGB()
+{
+  static qreal table[256];
+  for (int i = 0; i < 256; ++i)
+  {
+    const qreal c = static_cast<qreal>(i) / 255; // 0.03928 * 255 > 10
+    table[i] = i <= 10 ? c/12.92 : qPow((c + 0.055)/1.055, 2.4);
+  }
+  return table;
+}
+
 // Taken from https://www.w3.org/TR/2008/REC-WCAG20-20081211/.
 // It isn't related to HSL lightness.
-static inline qreal luminance(QColor col)
+static inline qreal luminance(const QColor &col)
 {
-  /* all divided by 255 */
-  qreal R = col.redF();
-  qreal G = col.greenF();
-  qreal B = col.blueF();
-
-  if(R <= 0.03928) R = R/12.92; else R = qPow((R + 0.055)/1.055, 2.4);
-  if(G <= 0.03928) G = G/12.92; else G = qPow((G + 0.055)/1.055, 2.4);
-  if(B <= 0.03928) B = B/12.92; else B = qPow((B + 0.055)/1.055, 2.4);
-
-  return 0.2126*R + 0.7152*G + 0.0722*B;
+  /* there are only 256 values per component, so they're precomputed */
+  static const qreal *linear = linearRGB();
+  const QRgb rgb = col.rgb();
+  return 0.2126*linear[qRed(rgb)] + 0.7152*linear[qGreen(rgb)] + 0.0722*linear[qBlue(rgb)];
 }
 
 bool Style::enoughContrast (const QColor& col1, const QColor& col2) const
@@ -145,45 +154,38 @@ void Style::opacifyColor(QColor& col) const
   }
 }
 
-/* Qt >= 5.2 accepts #ARGB as the color name but most apps use #RGBA.
-   Here we get the alpha from #RGBA if it exists. */
-QColor Style::getFromRGBA(const QString &str) const
-{
-  QColor col(str);
-  if (str.isEmpty() || !(str.size() == 9 && str.startsWith("#")))
-    return col;
-  bool ok;
-  int alpha = str.right(2).toInt(&ok, 16);
-  if (ok)
-  {
-    QString tmp(str);
-    tmp.remove(7, 2);
-    col = QColor(tmp);
-    col.setAlpha(alpha);
-  }
-  return col;
-}
-
-/* Qt >= 5.2 gives #AARRGGBB, while we want #RRGGBBAA. */
-static inline QString getName(const QColor col)
-{
-  QString colName = col.name();
-  long alpha = col.alpha();
-  if (alpha < 255)
-    colName += QString::number(alpha, 16);
-  return colName;
-}
-
 Style::Style(bool useDark) : QCommonStyle()
 {
-  progressTimer_ = new QTimer(this);
+  frameClock_ = new FrameClock(1000/ANIMATION_FRAME, this);
+  progressTimer_ = new FrameTimer(frameClock_, this);
+  progressTime_ = 0;
   opacityTimer_ = opacityTimerOut_ = nullptr;
   animationOpacity_ = animationOpacityOut_ = 100;
-  animationStartState_ = animationStartStateOut_ = "normal";
+  animationStartState_ = animationStartStateOut_ = NormalState;
   animatedWidget_ = animatedWidgetOut_ = nullptr;
 
   settings_ = defaultSettings_ = themeSettings_ = nullptr;
   defaultRndr_ = themeRndr_ = nullptr;
+  sharedAtlas_ = nullptr;
+  labelShadows_.setMaxCost(4*1024); // in KiB
+  animationFrames_.setMaxCost(4*1024); // in KiB
+  iconPixmaps_.setMaxCost(4*1024); // in KiB
+
+  Profiler::init();
+  if (Profiler::isEnabled())
+  {
+    Profiler::instance()->setCacheStats([this]() {
+      QJsonObject stats;
+      stats.insert(QStringLiteral("renderCacheHits"), static_cast<double>(renderCache_.hits()));
+      stats.insert(QStringLiteral("renderCacheMisses"), static_cast<double>(renderCache_.misses()));
+      stats.insert(QStringLiteral("renderCacheEvictions"), static_cast<double>(renderCache_.evictions()));
+      stats.insert(QStringLiteral("renderCacheBytes"), static_cast<double>(renderCache_.size()));
+      stats.insert(QStringLiteral("renderCacheBudget"), static_cast<double>(renderCache_.budget()));
+      stats.insert(QStringLiteral("internedElements"), elementNames_.size());
+      stats.insert(QStringLiteral("sharedAtlas"), sharedAtlas_ != nullptr);
+      return stats;
+    });
+  }
 
   gtkDesktop_ = false;
   noComposite_ = false;
@@ -244,6 +246,9 @@ Style::Style(bool useDark) : QCommonStyle()
   hspec_ = settings_->getHacksSpec();
   cspec_ = settings_->getColorSpec();
 
+  renderCache_.setBudget(static_cast<qint64>(tspec_.render_cache_size)*1024*1024);
+  frameClock_->setFrameRate(tspec_.animation_fps);
+
 #if (QT_VERSION >= QT_VERSION_CHECK(5,14,0))
   QList<QByteArray> desktopList = qgetenv("XDG_CURRENT_DESKTOP").toLower().split(':');
   QSet<QByteArray> desktop(desktopList.begin(), desktopList.end());
@@ -316,14 +321,14 @@ Style::Style(bool useDark) : QCommonStyle()
   ticklessSliderHandleSize_ = -1;
   isKisSlider_ = false;
 
-  connect(progressTimer_, &QTimer::timeout, this, &Style::advanceProgressbar);
+  connect(progressTimer_, &FrameTimer::timeout, this, &Style::advanceProgressbar);
 
   if (tspec_.animate_states)
   {
-    opacityTimer_ = new QTimer(this);
-    opacityTimerOut_ = new QTimer(this);
-    connect(opacityTimer_, &QTimer::timeout, this, &Style::setAnimationOpacity);
-    connect(opacityTimerOut_, &QTimer::timeout, this, &Style::setAnimationOpacityOut);
+    opacityTimer_ = new FrameTimer(frameClock_, this);
+    opacityTimerOut_ = new FrameTimer(frameClock_, this);
+    connect(opacityTimer_, &FrameTimer::timeout, this, &Style::setAnimationOpacity);
+    connect(opacityTimerOut_, &FrameTimer::timeout, this, &Style::setAnimationOpacityOut);
   }
 
   itsShortcutHandler_ = nullptr;
@@ -334,13 +339,13 @@ Style::Style(bool useDark) : QCommonStyle()
   hasActiveIndicator_ = joinedActiveTab_ = joinedActiveFloatingTab_ = hasFloatingTabs_ = false;
   if (themeRndr_ && themeRndr_->isValid())
   {
-    if (themeRndr_->elementExists(getIndicatorSpec(QStringLiteral("Tab")).element+"-close-toggled"))
+    if (themeRndr_->elementExists(getIndicatorSpec(TabClass).element+"-close-toggled"))
       hasActiveIndicator_ = true;
-    if (themeRndr_->elementExists("floating-"+getInteriorSpec(QStringLiteral("Tab")).element+"-normal"))
+    if (themeRndr_->elementExists("floating-"+getInteriorSpec(TabClass).element+"-normal"))
       hasFloatingTabs_ = true;
     if (tspec_.joined_inactive_tabs)
     {
-      QString sepName = getFrameSpec(QStringLiteral("Tab")).element + "-separator";
+      QString sepName = getFrameSpec(TabClass).element + "-separator";
       if (themeRndr_->elementExists(sepName+"-normal")
           || themeRndr_->elementExists(sepName+"-toggled"))
       {
@@ -362,15 +367,15 @@ Style::Style(bool useDark) : QCommonStyle()
   hasInactiveSelItemCol_ = toggledItemHasContrast_ = false;
   if (!tspec_.no_inactiveness)
   {
-    const label_spec lspec = getLabelSpec(QStringLiteral("ItemView"));
-    QColor toggleInactiveCol = getFromRGBA(lspec.toggleInactiveColor);
+    const label_spec lspec = getLabelSpec(ItemViewClass);
+    QColor toggleInactiveCol = lspec.toggleInactiveColor;
     if (toggleInactiveCol.isValid())
     {
-      QColor toggleActiveCol = getFromRGBA(lspec.toggleColor);
+      QColor toggleActiveCol = lspec.toggleColor;
       if (toggleActiveCol.isValid() && toggleActiveCol != toggleInactiveCol)
       {
         hasInactiveSelItemCol_ = true;
-        if (enoughContrast(toggleActiveCol, getFromRGBA(lspec.pressColor)))
+        if (enoughContrast(toggleActiveCol, lspec.pressColor))
           toggledItemHasContrast_ = true;
       }
     }
@@ -392,7 +397,7 @@ Style::Style(bool useDark) : QCommonStyle()
     QList<qreal> tooltipS;
     if (tspec_.tooltip_shadow_depth > 0)
     {
-      const frame_spec fspec = getFrameSpec(QStringLiteral("ToolTip"));
+      const frame_spec fspec = getFrameSpec(ToolTipClass);
       int thickness = qMax(qMax(fspec.top,fspec.bottom), qMax(fspec.left,fspec.right));
       thickness += tspec_.tooltip_shadow_depth;
       tooltipS = getShadow(QStringLiteral("ToolTip"), thickness);
@@ -404,6 +409,12 @@ Style::Style(bool useDark) : QCommonStyle()
 
 Style::~Style()
 {
+  if (Profiler::isEnabled())
+  {
+    Profiler::instance()->dump();
+    Profiler::instance()->setCacheStats(nullptr); // the caches are deleted
+  }
+
   QHash<const QObject*, Animation*>::iterator i = animations_.begin();
   while (i != animations_.end())
   {
@@ -438,12 +449,15 @@ Style::~Style()
     delete opacityTimerOut_;
     opacityTimerOut_ = nullptr;
   }
+  delete frameClock_; // after its timers
+  frameClock_ = nullptr;
 
   delete defaultSettings_;
   delete themeSettings_;
 
   delete defaultRndr_;
   delete themeRndr_;
+  delete sharedAtlas_;
 }
 
 void Style::setBuiltinDefaultTheme()
@@ -459,9 +473,34 @@ void Style::setBuiltinDefaultTheme()
     defaultRndr_ = nullptr;
   }
 
+  /* interned elements may refer to the old renderer */
+  clearThemeCaches();
+
   defaultSettings_ = new ThemeConfig(QStringLiteral(":/Kvantum/default.kvconfig"));
-  defaultRndr_ = new QSvgRenderer();
-  defaultRndr_->load(QStringLiteral(":/Kvantum/default.svg"));
+  defaultRndr_ = new LazySvgRenderer(QStringLiteral(":/Kvantum/default.svg"));
+}
+
+void Style::clearThemeCaches()
+{
+  elementIds_.clear();
+  elementNames_.clear();
+  resolvedElements_.clear();
+  stateElementIds_.clear();
+  suffixElementIds_.clear();
+  frameElementIds_.clear();
+  frameElements_.clear();
+  expandedInteriors_.clear();
+  renderCache_.clear();
+  windowBgs_.clear();
+  labelShadows_.clear();
+  shadows_.clear();
+  animationFrames_.clear();
+  iconPixmaps_.clear();
+  widgetSpecs_.clear();
+  themeMetrics_.clear();
+  expandedBorders_.clear();
+  flatArrows_.clear();
+  elements_.clear();
 }
 
 static inline bool isThemeDir(const QString &path, const QString &themeName)
@@ -485,6 +524,9 @@ static inline bool isThemeDir(const QString &path, const QString &themeName)
 
 void Style::setTheme(const QString &baseThemeName, bool useDark)
 {
+  /* nothing found in the SVG image of the previous theme is valid anymore */
+  clearThemeCaches();
+
   if (themeSettings_)
   {
     delete themeSettings_;
@@ -495,6 +537,12 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
     delete themeRndr_;
     themeRndr_ = nullptr;
   }
+  if (sharedAtlas_)
+  {
+    delete sharedAtlas_;
+    sharedAtlas_ = nullptr;
+  }
+  themeSvg_.clear();
 
   if (!baseThemeName.isNull() && !baseThemeName.isEmpty()
       /* "Default" is reserved by Kvantum Manager for copied default theme */
@@ -615,8 +663,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
           themeSettings_ = new ThemeConfig(userConfig);
         if (!userSvg.isEmpty())
         {
-          themeRndr_ = new QSvgRenderer();
-          themeRndr_->load(userSvg);
+          loadThemeSvg(userSvg);
         }
         if (themeSettings_ || themeRndr_)
         {
@@ -681,8 +728,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
        ***************/
       if (!userSvg.isEmpty())
       { // user theme
-        themeRndr_ = new QSvgRenderer();
-        themeRndr_->load(userSvg);
+        loadThemeSvg(userSvg);
       }
       else
       {
@@ -694,8 +740,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
                    + QString("/Kvantum/%1/%1.svg").arg(themeName);
             if (QFile::exists(temp))
             {
-              themeRndr_ = new QSvgRenderer();
-              themeRndr_->load(temp);
+              loadThemeSvg(temp);
             }
             else if (!isThemeDir(QString(DATADIR) + "/Kvantum", themeName) // config shouldn't be found
                      && isThemeDir(QString(DATADIR) + "/Kvantum", lightName))
@@ -704,8 +749,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
                      + QString("/Kvantum/%1/%2.svg").arg(lightName).arg(themeName);
               if (QFile::exists(temp))
               {
-                themeRndr_ = new QSvgRenderer();
-                themeRndr_->load(temp);
+                loadThemeSvg(temp);
               }
             }
 
@@ -719,8 +763,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
                        + QString("/themes/%1/Kvantum/%1.svg").arg(themeName);
                 if (QFile::exists(temp))
                 {
-                  themeRndr_ = new QSvgRenderer();
-                  themeRndr_->load(temp);
+                  loadThemeSvg(temp);
                 }
               }
 
@@ -736,8 +779,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
                          + QString("/themes/%1/Kvantum/%2.svg").arg(lightName).arg(themeName);
                   if (QFile::exists(temp))
                   {
-                    themeRndr_ = new QSvgRenderer();
-                    themeRndr_->load(temp);
+                    loadThemeSvg(temp);
                   }
                 }
               }
@@ -753,8 +795,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
                    + QString("/Kvantum/%1/%1.svg").arg(_themeName);
             if (QFile::exists(temp))
             {
-              themeRndr_ = new QSvgRenderer();
-              themeRndr_->load(temp);
+              loadThemeSvg(temp);
             }
             else if (isThemeDir(QString(DATADIR) + "/Kvantum", lightName))
             {
@@ -762,8 +803,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
                      + QString("/Kvantum/%1/%2.svg").arg(lightName).arg(_themeName);
               if (QFile::exists(temp))
               {
-                themeRndr_ = new QSvgRenderer();
-                themeRndr_->load(temp);
+                loadThemeSvg(temp);
               }
             }
 
@@ -777,8 +817,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
                        + QString("/themes/%1/Kvantum/%1.svg").arg(_themeName);
                 if (QFile::exists(temp))
                 {
-                  themeRndr_ = new QSvgRenderer();
-                  themeRndr_->load(temp);
+                  loadThemeSvg(temp);
                 }
               }
 
@@ -794,8 +833,7 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
                          + QString("/themes/%1/Kvantum/%2.svg").arg(lightName).arg(_themeName);
                   if (QFile::exists(temp))
                   {
-                    themeRndr_ = new QSvgRenderer();
-                    themeRndr_->load(temp);
+                    loadThemeSvg(temp);
                   }
                 }
               }
@@ -811,6 +849,12 @@ void Style::setTheme(const QString &baseThemeName, bool useDark)
   setupThemeDeps();
 }
 
+void Style::loadThemeSvg(const QString &svgFile)
+{
+  themeRndr_ = new LazySvgRenderer(svgFile);
+  themeSvg_ = svgFile;
+}
+
 void Style::setupThemeDeps()
 {
   if (themeSettings_)
@@ -821,28 +865,103 @@ void Style::setupThemeDeps()
   }
   else
     settings_ = defaultSettings_;
+
+  /* For sessions with many processes (as on thin clients), frame
+     parts can be shared by setting KVANTUM_SHARED_ATLAS to the
+     size of the shared memory in MiB. The theme is identified by
+     its SVG image, which may be modified by the user. */
+  int atlasSize = qgetenv("KVANTUM_SHARED_ATLAS").toInt();
+  if (atlasSize > 0)
+  {
+    QString theme = QStringLiteral("Default");
+    if (!themeSvg_.isEmpty())
+    {
+      QFileInfo info(themeSvg_);
+      theme = info.absoluteFilePath() + QLatin1Char('|')
+              + QString::number(info.lastModified().toMSecsSinceEpoch())
+              + QLatin1Char('|') + QString::number(info.size());
+    }
+    sharedAtlas_ = new SharedAtlas(theme,
+                                   qMax(qApp->devicePixelRatio(), static_cast<qreal>(1)),
+                                   atlasSize);
+    if (!sharedAtlas_->isValid())
+    {
+      delete sharedAtlas_;
+      sharedAtlas_ = nullptr;
+    }
+  }
+}
+
+/* The region of a busy indicator inside its track (it consists
+   of two rectangles when the indicator reaches the track end) */
+static QRegion busyIndicatorRegion(const QRect &track, int animcount, int width, bool inverted)
+{
+  QRect R(track);
+  if (inverted)
+    R.setX(track.x()+track.width()-(animcount % track.width()));
+  else
+    R.setX(track.x()+(animcount % track.width()));
+  R.setWidth(width);
+  QRegion res(R & track);
+  if (R.x()+R.width() > track.x()+track.width())
+    res += QRect(track.x(), track.y(), R.x()+R.width()-track.x()-track.width(), track.height());
+  return res;
 }
 
 void Style::advanceProgressbar()
 {
+  /* advance bars by the elapsed time, regardless of the frame rate */
+  progressTime_ += progressTimer_->elapsed();
+  const int step = progressTime_ / PROGRESS_PIXEL_TIME;
+  if (step == 0) return;
+  progressTime_ %= PROGRESS_PIXEL_TIME;
+
+  bool visible = false;
   QMap<QWidget *,int>::iterator it;
   for (it = progressbars_.begin(); it != progressbars_.end(); ++it)
   {
     QWidget *widget = it.key();
-    if (widget && widget->isVisible())
+    /* skip bars that can't be seen (they'll be painted when they can) */
+    if (widget && widget->isVisible()
+        && !widget->window()->isMinimized()
+        && !widget->visibleRegion().isEmpty())
     {
-      if (it.value() > INT_MAX - 2)
+      visible = true;
+      int animcount = it.value();
+      if (it.value() > INT_MAX - step)
         it.value() = 0;
       else
-        it.value() += 2;
-      widget->update();
+        it.value() += step;
+
+      /* repaint only the old and new places of the indicator
+         because the rest of the bar doesn't change */
+      QHash<const QWidget*, busy_indicator>::const_iterator bi = busyIndicators_.constFind(widget);
+      if (bi == busyIndicators_.constEnd() || bi.value().track.width() <= 0)
+        widget->update();
+      else
+      {
+        const busy_indicator &indicator = bi.value();
+        QRegion dirty = busyIndicatorRegion(indicator.track, animcount,
+                                            indicator.width, indicator.inverted)
+                        + busyIndicatorRegion(indicator.track, it.value(),
+                                              indicator.width, indicator.inverted);
+        /* a margin for antialiasing */
+        widget->update(indicator.transform.map(dirty).boundingRect().adjusted(-1,-1,1,1));
+      }
     }
   }
+  /* the timer is started again when a busy progress bar is painted */
+  if (!visible)
+    progressTimer_->stop();
 }
 
 void Style::startAnimation(Animation *animation) const
 {
   stopAnimation(animation->target());
+  /* Qt's animation timer is shared by all animations but
+     the frame rate of the style is respected */
+  animation->setFrameRate(frameClock_->frameRate() >= 60 ? Animation::SixtyFps
+                                                         : Animation::ThirtyFps);
   connect(animation, &QObject::destroyed, this, &Style::removeAnimation, Qt::UniqueConnection);
   animations_.insert(animation->target(), animation);
   animation->start();
@@ -868,11 +987,17 @@ void Style::removeAnimation(QObject *animation)
 void Style::setAnimationOpacity()
 { //qDebug() << animationOpacity_;
   if (animationOpacity_ >= 100 || !animatedWidget_)
+  {
     opacityTimer_->stop();
+    if (!opacityTimerOut_->isActive())
+      animationFrames_.clear(); // the animations are finished
+  }
   else
   {
-    if (animationOpacity_ <= 100 - OPACITY_STEP)
-      animationOpacity_ += OPACITY_STEP;
+    /* advance by the elapsed time, regardless of the frame rate */
+    int step = qMax(OPACITY_STEP * opacityTimer_->elapsed() / ANIMATION_FRAME, 1);
+    if (animationOpacity_ <= 100 - step)
+      animationOpacity_ += step;
     else
       animationOpacity_ = 100;
     animatedWidget_->update();
@@ -882,11 +1007,17 @@ void Style::setAnimationOpacity()
 void Style::setAnimationOpacityOut()
 { //qDebug() << animatedWidgetOut_;
   if (animationOpacityOut_ >= 100 || !animatedWidgetOut_)
+  {
     opacityTimerOut_->stop();
+    if (!opacityTimer_->isActive())
+      animationFrames_.clear(); // the animations are finished
+  }
   else
   {
-    if (animationOpacityOut_ <= 100 - OPACITY_STEP)
-      animationOpacityOut_ += OPACITY_STEP;
+    /* advance by the elapsed time, regardless of the frame rate */
+    int step = qMax(OPACITY_STEP * opacityTimerOut_->elapsed() / ANIMATION_FRAME, 1);
+    if (animationOpacityOut_ <= 100 - step)
+      animationOpacityOut_ += step;
     else
       animationOpacityOut_ = 100;
     animatedWidgetOut_->update();
@@ -901,7 +1032,7 @@ int Style::getMenuMargin(bool horiz) const
   if (!horiz || !(tspec_.spread_menuitems
                   && (tspec_.shadowless_popup || noComposite_ || !tspec_now.composite)))
   {
-    const frame_spec fspec = getFrameSpec(QStringLiteral("Menu"));
+    const frame_spec fspec = getFrameSpec(MenuClass);
     margin = horiz ? qMax(fspec.left,fspec.right) : qMax(fspec.top,fspec.bottom);
   }
   if (!tspec_.shadowless_popup && !noComposite_) // used without compositing at PM_SubMenuOverlap
@@ -927,40 +1058,51 @@ QList<qreal> Style::getShadow(const QString &widgetName, int thicknessH, int thi
     return menuShadow_;
   }
 
+  /* the SVG bounds are queried only once per theme */
+  const QPair<QString,QPair<int,int>> key(widgetName, qMakePair(thicknessH, thicknessV));
+  QHash<QPair<QString,QPair<int,int>>, QList<qreal>>::const_iterator it = shadows_.constFind(key);
   QList<qreal> s;
-  s << 0 << 0 << 0 << 0;
+  if (it != shadows_.constEnd())
+    s = it.value();
+  else
+  {
+    s << 0 << 0 << 0 << 0;
 
-  QSvgRenderer *renderer = 0;
-  qreal divisor = 0;
-  QList<QString> direction;
-  direction << QStringLiteral("left") << QStringLiteral("top") << QStringLiteral("right") << QStringLiteral("bottom");
-  frame_spec fspec = getFrameSpec(widgetName);
-  QString element = fspec.element;
+    QSvgRenderer *renderer = 0;
+    qreal divisor = 0;
+    QList<QString> direction;
+    direction << QStringLiteral("left") << QStringLiteral("top") << QStringLiteral("right") << QStringLiteral("bottom");
+    frame_spec fspec = getFrameSpec(widgetName);
+    QString element = fspec.element;
 
-  for (int i = 0; i < 4; ++i)
-  {
-    if (themeRndr_ && themeRndr_->isValid() && themeRndr_->elementExists(element+"-shadow-"+direction[i]))
-      renderer = themeRndr_;
-    else renderer = defaultRndr_;
-    if (renderer)
+    for (int i = 0; i < 4; ++i)
     {
-      QRectF br = renderer->boundsOnElement(element+"-shadow-"+direction[i]);
-      divisor = (i%2 ? br.height() : br.width());
-      if (divisor)
+      renderer = 0;
+      if (themeRndr_ && themeRndr_->isValid() && themeRndr_->elementExists(element+"-shadow-"+direction[i]))
+        renderer = themeRndr_->renderer();
+      if (!renderer) renderer = defaultRndr_->renderer();
+      if (renderer)
       {
-        if (themeRndr_ && themeRndr_->isValid() && themeRndr_->elementExists(element+"-shadow-hint-"+direction[i]))
-          renderer = themeRndr_;
-        else if (defaultRndr_->elementExists(element+"-shadow-hint-"+direction[i]))
-          renderer = defaultRndr_;
-        else renderer = 0;
-        if (renderer)
+        QRectF br = renderer->boundsOnElement(element+"-shadow-"+direction[i]);
+        divisor = (i%2 ? br.height() : br.width());
+        if (divisor)
         {
-          br = renderer->boundsOnElement(element+"-shadow-hint-"+direction[i]);
-          s[i] = i%2 ? static_cast<qreal>(thicknessV)*(br.height()/divisor)
-                     : static_cast<qreal>(thicknessH)*(br.width()/divisor);
+          renderer = 0;
+          if (themeRndr_ && themeRndr_->isValid() && themeRndr_->elementExists(element+"-shadow-hint-"+direction[i]))
+            renderer = themeRndr_->renderer();
+          if (!renderer && defaultRndr_->elementExists(element+"-shadow-hint-"+direction[i]))
+            renderer = defaultRndr_->renderer();
+          if (renderer)
+          {
+            br = renderer->boundsOnElement(element+"-shadow-hint-"+direction[i]);
+            s[i] = i%2 ? static_cast<qreal>(thicknessV)*(br.height()/divisor)
+                       : static_cast<qreal>(thicknessH)*(br.width()/divisor);
+          }
         }
       }
     }
+
+    shadows_.insert(key, s);
   }
 
   if (widgetName == "Menu")
@@ -1039,7 +1181,7 @@ bool Style::isStylableToolbar(const QWidget *w, bool allowInvisible) const
   const QToolBar *tb = qobject_cast<const QToolBar*>(w);
   if (!tb
       || w->autoFillBackground()
-      || w->findChild<QTabBar*>() // practically not a toolbar (Kaffeine's sidebar)
+      || toolbarHasTabBar(w) // practically not a toolbar (Kaffeine's sidebar)
 #if (QT_VERSION >= QT_VERSION_CHECK(5,12,0))
       || w->testAttribute(Qt::WA_StyleSheetTarget) // not drawn by Kvantum (CE_ToolBar may not be called)
 #endif
@@ -1081,15 +1223,33 @@ QWidget* Style::getStylableToolbarContainer(const QWidget *w, bool allowInvisibl
   if (window == w) return nullptr;
   if (isStylableToolbar(window, allowInvisible)) // detached toolbar
     return window;
-  const QList<QToolBar*> toolbars = window->findChildren<QToolBar*>(QString(), Qt::FindDirectChildrenOnly);
-  for (QToolBar *tb : toolbars)
-  {
-    if (isStylableToolbar(tb, allowInvisible) && tb->isAncestorOf(w))
-      return tb;
-  }
+  /* a stylable toolbar is a child of the window, so only the ancestor of
+     the widget that is a child of the window can contain it, and there's
+     no need to search for the toolbars of the window */
+  QWidget *p = w->parentWidget();
+  if (p == window) return nullptr;
+  while (p && p->parentWidget() != window)
+    p = p->parentWidget();
+  if (qobject_cast<QToolBar*>(p) && isStylableToolbar(p, allowInvisible))
+    return p;
   return nullptr;
 }
 
+/* Finding a tab bar inside a toolbar isn't cheap because all its descendants
+   are searched. So, the result is kept until a child is added to or removed
+   from the toolbar (see eventFilter). */
+bool Style::toolbarHasTabBar(const QWidget *toolbar) const
+{
+  QHash<const QWidget*, tabbed_toolbar>::const_iterator it = tabbedToolbars_.constFind(toolbar);
+  if (it != tabbedToolbars_.constEnd() && it.value().toolbar)
+    return it.value().hasTabBar;
+  tabbed_toolbar tt;
+  tt.toolbar = toolbar;
+  tt.hasTabBar = (toolbar->findChild<QTabBar*>() != nullptr);
+  tabbedToolbars_.insert(toolbar, tt);
+  return tt.hasTabBar;
+}
+
 // This is only called when the widget doesn't have an interior SVG element.
 bool Style::hasHighContrastWithContainer(const QWidget *w, const QColor color) const
 {
@@ -1112,7 +1272,7 @@ bool Style::hasHighContrastWithContainer(const QWidget *w, const QColor color) c
     }
   }
   if(!container.isEmpty()
-     && enoughContrast(color, getFromRGBA(getLabelSpec(container).normalColor)))
+     && enoughContrast(color, getLabelSpec(container).normalColor))
   {
     return true;
   }
@@ -1142,25 +1302,16 @@ enum groupedTBtnKind
 
 static QSet<QWidget*> btnSeparators;
 
-int Style::whichGroupedTBtn(const QToolButton *tb, const QWidget *parentBar, bool &drawSeparator) const
+Style::grouped_tbtn Style::groupedTBtn(const QToolButton *tb, const QWidget *parentBar) const
 {
-  int res = tbAlone;
-  drawSeparator = false;
-
-  if (!tb || !parentBar
-      /* Although the toolbar extension button can be on the immediate right of
-         the last toolbutton, there's a 1px gap between them. I see this as a
-         Qt bug but because of it, the extension button should be excluded here. */
-      || tb->objectName() == "qt_toolbar_ext_button")
-  {
-    return res;
-  }
+  grouped_tbtn res;
+  res.kind = tbAlone;
 
   const QRect g = tb->geometry();
   QToolButton *left = qobject_cast<QToolButton*>(parentBar->childAt(g.x()-1, g.y()));
   if (left && left->objectName() == "qt_toolbar_ext_button")
     left = nullptr;
-  const QToolButton *right =  qobject_cast<const QToolButton*>(parentBar->childAt(g.x()+g.width()+1, g.y()));
+  QToolButton *right =  qobject_cast<QToolButton*>(parentBar->childAt(g.x()+g.width()+1, g.y()));
   if (right && right->objectName() == "qt_toolbar_ext_button")
     right = nullptr;
 
@@ -1170,29 +1321,64 @@ int Style::whichGroupedTBtn(const QToolButton *tb, const QWidget *parentBar, boo
   if (right && right->parentWidget() != parentBar)
     right = nullptr;
 
+  if (right && g.height() != right->height())
+    right = nullptr;
   if (left && g.height() == left->height())
+    res.kind = right ? tbMiddle : tbRight;
+  else if (right)
+    res.kind = tbLeft;
+
+  res.left = left;
+  res.right = right;
+  return res;
+}
+
+int Style::whichGroupedTBtn(const QToolButton *tb, const QWidget *parentBar, bool &drawSeparator) const
+{
+  int res = tbAlone;
+  drawSeparator = false;
+
+  if (!tb || !parentBar
+      /* Although the toolbar extension button can be on the immediate right of
+         the last toolbutton, there's a 1px gap between them. I see this as a
+         Qt bug but because of it, the extension button should be excluded here. */
+      || tb->objectName() == "qt_toolbar_ext_button")
+  {
+    return res;
+  }
+
+  /* the neighbors of the buttons of a toolbar are found once per toolbar
+     layout (see eventFilter) but other bars aren't watched for layouts */
+  grouped_tbtn gtb;
+  if (qobject_cast<const QToolBar*>(parentBar))
   {
-    if (right && g.height() == right->height())
+    toolbar_layout &tl = toolbarLayouts_[parentBar];
+    if (!tl.toolbar) // a new toolbar or a destroyed one
     {
-      res = tbMiddle;
-      if ((tb->isChecked() && !right->isChecked() && !right->isDown())
-          || (!tb->isChecked() && !tb->isDown() && right->isChecked()))
-      {
-        drawSeparator = true;
-      }
+      tl.toolbar = parentBar;
+      tl.buttons.clear();
     }
+    QHash<const QWidget*, grouped_tbtn>::const_iterator it = tl.buttons.constFind(tb);
+    if (it != tl.buttons.constEnd())
+      gtb = it.value();
     else
-      res = tbRight;
-  }
-  else if (right && g.height() == right->height())
-  {
-    res = tbLeft;
-    if ((tb->isChecked() && !right->isChecked() && !right->isDown())
-        || (!tb->isChecked() && !tb->isDown() && right->isChecked()))
     {
-      drawSeparator = true;
+      gtb = groupedTBtn(tb, parentBar);
+      tl.buttons.insert(tb, gtb);
     }
   }
+  else
+    gtb = groupedTBtn(tb, parentBar);
+
+  res = gtb.kind;
+  QToolButton *left = gtb.left.data();
+  const QToolButton *right = gtb.right.data();
+  if (right
+      && ((tb->isChecked() && !right->isChecked() && !right->isDown())
+          || (!tb->isChecked() && !tb->isDown() && right->isChecked())))
+  {
+    drawSeparator = true;
+  }
 
   if (drawSeparator)
   {
@@ -1473,63 +1659,108 @@ void Style::forceButtonTextColor(QWidget *widget, QColor col) const
   }
 }
 
+/* Remove the '&' mnemonic character and tabs (for menu items)
+   in one pass. "&&" is kept as a literal '&'. */
+static inline QString strippedText(const QString &text)
+{
+  QString t;
+  t.reserve(text.size());
+  bool escaped = false;
+  const QChar *c = text.constData();
+  const QChar *end = c + text.size();
+  for (; c != end; ++c)
+  {
+    if (*c == QLatin1Char('\t'))
+      continue;
+    if (!escaped && *c == QLatin1Char('&'))
+    {
+      escaped = true;
+      continue;
+    }
+    escaped = false;
+    t.append(*c);
+  }
+  return t;
+}
+
 /* Compute the size of a text. */
-static inline QSize textSize(const QFont &font, const QString &text)
+static QSize textSize(const QFont &font, const QString &text)
 {
+  if (text.isEmpty())
+    return QSize(0,0);
+
+  /* sizeFromContents() measures the same texts in every layout pass
+     (the least recently used sizes are forgotten) */
+  static QCache<QPair<QFont,QString>, QSize> textSizes(2000);
+  const QPair<QFont,QString> key(font, text);
+  if (QSize *cached = textSizes.object(key))
+    return *cached;
+
   int tw, th;
   tw = th = 0;
 
-  if (!text.isEmpty())
-  {
-    QString t(text);
-    /* remove the '&' mnemonic character and tabs (for menu items) */
-    t.remove('\t');
-    int i = 0;
-    while (i < t.size())
-    {
-      if (t.at(i) == '&')
-        t.remove(i,1);
-      i++;
-    }
+  const QString t = strippedText(text);
+  const QFontMetrics fm(font);
 
-    /* deal with newlines */
-    QStringList l = t.split('\n');
+  /* deal with newlines */
+  QStringList l = t.split('\n');
 
-    th = QFontMetrics(font).height()*(l.size());
+  th = fm.height()*(l.size());
 
-    for (int i=0; i<l.size(); i++)
+  for (int i=0; i<l.size(); i++)
 #if (QT_VERSION >= QT_VERSION_CHECK(5,11,0))
-      tw = qMax(tw,QFontMetrics(font).horizontalAdvance(l[i]));
+    tw = qMax(tw,fm.horizontalAdvance(l[i]));
 #else
-      tw = qMax(tw,QFontMetrics(font).width(l[i]));
+    tw = qMax(tw,fm.width(l[i]));
 #endif
 
-    if (l.size() > 1)
-    {
-      QRect br = QFontMetrics(font).boundingRect(QRect(0,0,tw,th), Qt::AlignCenter, text);
-      th = br.height();
-    }
+  if (l.size() > 1)
+  {
+    QRect br = fm.boundingRect(QRect(0,0,tw,th), Qt::AlignCenter, text);
+    th = br.height();
   }
 
+  textSizes.insert(key, new QSize(tw,th));
   return QSize(tw,th);
 }
 
-QString Style::getState(const QStyleOption *option, const QWidget *widget) const
+const QString &Style::stateName(int state)
+{
+  static const QString names[stateCount] = {
+    QStringLiteral("normal"), QStringLiteral("focused"), QStringLiteral("pressed"),
+    QStringLiteral("toggled"), QStringLiteral("disabled"),
+    QStringLiteral("normal-inactive"), QStringLiteral("focused-inactive"), QStringLiteral("pressed-inactive"),
+    QStringLiteral("toggled-inactive"), QStringLiteral("disabled-inactive")
+  };
+  return names[stateIndex(state)];
+}
+
+int Style::animationStartStateOf(const QObject *styleObject)
+{
+  if (!styleObject)
+    return NoState;
+  bool ok;
+  int state = styleObject->property("_kv_state").toInt(&ok);
+  return ok ? state : NoState;
+}
+
+int Style::getWidgetState(const QStyleOption *option, const QWidget *widget) const
 { // here only widget may be NULL
-  QString status =
+  int state =
         (option->state & State_Enabled) ?
-          (option->state & State_On) ? "toggled" :
-          (option->state & State_Sunken) ? "pressed" :
-          (option->state & State_Selected) ? "toggled" :
-          (option->state & State_MouseOver) ? "focused" : "normal"
-        : "disabled";
+          (option->state & State_On) ? ToggledState :
+          (option->state & State_Sunken) ? PressedState :
+          (option->state & State_Selected) ? ToggledState :
+          (option->state & State_MouseOver) ? FocusedState : NormalState
+        : DisabledState;
   if (isWidgetInactive(widget))
-    status.append("-inactive");
-  return status;
+    state |= InactiveState;
+  return state;
 
   /*
      The following condition will be needed later:
-       (option->state & State_Enabled) && ((status.startsWith("toggled") || status.startsWith("pressed"))
+       (option->state & State_Enabled)
+       && (baseState(state) == ToggledState || baseState(state) == PressedState)
      Logically, it can be written as:
        (A || (!B && C)) || (!A && B)
      where,
@@ -1550,8 +1781,8 @@ void Style::drawFocusRect(QPainter *painter, const QRect &rect, const QString &e
   fspec.top = qMin(fspec.top,2);
   fspec.bottom = qMin(fspec.bottom,2);
   if (!element.isEmpty())
-    fspec.element = element;
-  renderFrame(painter,rect,fspec,fspec.element);
+    setSpecElement(fspec, element);
+  renderFrame(painter,rect,fspec,fspec.elementId,NoState);
 }
 
 /* This method is used, instead of drawPrimitive(PE_PanelLineEdit,...), for drawing the lineedit
@@ -1566,24 +1797,25 @@ void Style::drawComboLineEdit(const QStyleOption *option,
   if (isPlasma_ && lineedit->window()->testAttribute(Qt::WA_NoSystemBackground))
     return;
 
-  QString group;
-  if ((!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-       || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+  int group;
+  if ((!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+       || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
       && getStylableToolbarContainer(lineedit, true)
       && !enoughContrast(lineedit->palette().color(QPalette::Active, QPalette::Text),
-                         getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
+                         getLabelSpec(ToolbarClass).normalColor))
   {
-    group = "ToolbarLineEdit";
+    group = ToolbarLineEditClass;
   }
   else
-    group = "LineEdit";
-  interior_spec ispec = getInteriorSpec(group);
-  frame_spec fspec = getFrameSpec(group);
-  label_spec lspec = getLabelSpec(group);
-  const size_spec sspec = getSizeSpec(group);
+    group = LineEditClass;
+  const widget_specs &specs = getWidgetSpecs(group);
+  interior_spec ispec = specs.ispec;
+  frame_spec fspec = specs.fspec;
+  label_spec lspec = labelSpec(specs);
+  const size_spec &sspec = specs.sspec;
 
   /* a workaround for bad codes that change line-edit base color */
-  bool colored = group == "LineEdit"
+  bool colored = group == LineEditClass
                  && lineedit->palette().color(QPalette::Base) != standardPalette().color(QPalette::Base);
 
   /*if (isLibreoffice_) // impossible because lineedit != NULL
@@ -1642,7 +1874,7 @@ void Style::drawComboLineEdit(const QStyleOption *option,
   fspec.isAttached = true;
   if (option->direction == Qt::RightToLeft)
   {
-    int arrowFrameSize = tspec_.combo_as_lineedit ? fspec.left : getFrameSpec(QStringLiteral("ComboBox")).left;
+    int arrowFrameSize = tspec_.combo_as_lineedit ? fspec.left : getFrameSpec(ComboBoxClass).left;
     if (lineedit->width() < combo->width()
                             - (tspec_.square_combo_button
                                ? qMax(COMBO_ARROW_LENGTH, combo->height()-arrowFrameSize)
@@ -1681,7 +1913,7 @@ void Style::drawComboLineEdit(const QStyleOption *option,
   }
   else
   {
-    QColor baseCol = lineedit->palette().color(leStatus.contains("-inactive")
+    QColor baseCol = lineedit->palette().color(leStatus.contains(QLatin1String("-inactive"))
                                                  ? QPalette::Inactive
                                                  : QPalette::Active,
                                                QPalette::Base);
@@ -1697,6 +1929,8 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                           QPainter *painter,
                           const QWidget *widget) const
 {
+  ProfileScope profileScope(Profiler::DrawPrimitive,element);
+
   int x,y,h,w;
   option->rect.getRect(&x,&y,&w,&h);
 
@@ -1748,15 +1982,15 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         {
           if (qobject_cast<QMenuBar*>(child) || qobject_cast<QToolBar*>(child))
           {
-            ispec = getInteriorSpec(QStringLiteral("Window"));
-            sspec = getSizeSpec(QStringLiteral("Window"));
+            ispec = getInteriorSpec(WindowClass);
+            sspec = getSizeSpec(WindowClass);
           }
         }
       }
       else
       {
-        ispec = getInteriorSpec(QStringLiteral("Window"));
-        sspec = getSizeSpec(QStringLiteral("Window"));
+        ispec = getInteriorSpec(WindowClass);
+        sspec = getSizeSpec(WindowClass);
       }
       frame_spec fspec;
       default_frame_spec(fspec);
@@ -1787,15 +2021,15 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       const interior_spec ispec = getInteriorSpec(QStringLiteral("Dock"));
       fspec.expansion = 0;
 
-      QString status = getState(option,widget);
+      int wState = getWidgetState(option,widget);
       if (!(option->state & State_Enabled))
       {
-        status.replace("disabled","normal");
+        wState = (wState & InactiveState) | NormalState;
         painter->save();
         painter->setOpacity(DISABLED_OPACITY);
       }
-      renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+status);
-      renderFrame(painter,option->rect,fspec,fspec.element+"-"+status);
+      renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,wState);
+      renderFrame(painter,option->rect,fspec,fspec.elementId,wState);
       if (!(option->state & State_Enabled))
         painter->restore();
 
@@ -1886,7 +2120,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
             bool joinedActiveTab = hasFloatingTabs_ ? joinedActiveFloatingTab_ : joinedActiveTab_;
             if (!joinedActiveTab || tspec_.no_active_tab_separator)
             {
-              fspec = getFrameSpec(QStringLiteral("Tab"));
+              fspec = getFrameSpec(TabClass);
               int exp = qMin(fspec.expansion, qMin(tr.width(), tr.height())) / 2 + 1;
               overlap = qMin(overlap, qMax(exp, qMax(fspec.left, fspec.right)));
               if (d == 0) // at the beginning
@@ -1908,21 +2142,16 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         const interior_spec ispec = getInteriorSpec(QStringLiteral("TabBarFrame"));
         fspec.expansion = 0;
 
-        QString status = getState(option,widget);
+        /* TabBarFrame seems to have a redundant focus state
+           and its disabled state is drawn by opacity */
+        const int wState = getWidgetState(option,widget) & InactiveState;
         if (!(option->state & State_Enabled))
         {
-          status.replace("disabled","normal");
           painter->save();
           painter->setOpacity(DISABLED_OPACITY);
         }
-        // TabBarFrame seems to have a redundant focus state
-        else if (!status.startsWith("normal"))
-        {
-          if (status.endsWith("-inactive")) status = "normal-inactive";
-          else status = "normal";
-        }
-        renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status);
-        renderFrame(painter,r,fspec,fspec.element+"-"+status, d,l,0,0,1);
+        renderInterior(painter,r,fspec,ispec,ispec.elementId,wState);
+        renderFrame(painter,r,fspec,fspec.elementId,wState, d,l,0,0,1);
         if (!(option->state & State_Enabled))
           painter->restore();
         if (verticalTabs || bottomTabs)
@@ -1935,31 +2164,32 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
     /* PE_PanelButtonCommand is used by QCommonStyle only inside CE_PushButtonBevel
        and CC_MdiControls but we don't use it. It's here for special cases. */
     case PE_PanelButtonCommand : {
-      const QString group = "PanelButtonCommand";
+      const int group = PanelButtonCommandClass;
 
-      frame_spec fspec = getFrameSpec(group);
-      const interior_spec ispec = getInteriorSpec(group);
+      const widget_specs &specs = getWidgetSpecs(group);
+      frame_spec fspec = specs.fspec;
+      const interior_spec &ispec = specs.ispec;
 
-      QString status;
+      int wState;
       if (option->state & State_Enabled)
-        status = getState(option,widget);
+        wState = getWidgetState(option,widget);
       else
       {
-        status = "normal";
+        wState = NormalState;
         if (option->state & State_On)
-          status = "toggled";
+          wState = ToggledState;
         if (isWidgetInactive(widget))
-          status.append("-inactive");
+          wState |= InactiveState;
         painter->save();
         painter->setOpacity(DISABLED_OPACITY);
       }
       const QStyleOptionButton *opt =
           qstyleoption_cast<const QStyleOptionButton*>(option);
       if (opt == nullptr
-          || !(opt->features & QStyleOptionButton::Flat) || !status.startsWith("normal"))
+          || !(opt->features & QStyleOptionButton::Flat) || baseState(wState) != NormalState)
       {
-        renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+status);
-        renderFrame(painter,option->rect,fspec,fspec.element+"-"+status);
+        renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,wState);
+        renderFrame(painter,option->rect,fspec,fspec.elementId,wState);
       }
       if (!(option->state & State_Enabled))
         painter->restore();
@@ -1982,7 +2212,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         }
       }
       interior_spec ispec;
-      QString group = "PanelButtonTool";
+      int group = PanelButtonToolClass;
       QWidget *p = getParent(widget,1);
       bool autoraise(option->state & State_AutoRaise);
       bool fillWidgetInterior(false);
@@ -1990,15 +2220,15 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       if (stb)
       {
         autoraise = true; // we make all toolbuttons auto-raised inside toolbars
-        if (!getFrameSpec(QStringLiteral("ToolbarButton")).element.isEmpty()
-            || !getInteriorSpec(QStringLiteral("ToolbarButton")).element.isEmpty())
+        if (!getFrameSpec(ToolbarButtonClass).element.isEmpty()
+            || !getInteriorSpec(ToolbarButtonClass).element.isEmpty())
         {
-          group = "ToolbarButton";
+          group = ToolbarButtonClass;
         }
         ispec = getInteriorSpec(group);
         if (!ispec.hasInterior
-            && enoughContrast(getFromRGBA(getLabelSpec(group).normalColor),
-                              getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
+            && enoughContrast(getLabelSpec(group).normalColor,
+                              getLabelSpec(ToolbarClass).normalColor))
         { // high contrast on toolbar
           fillWidgetInterior = true;
         }
@@ -2008,24 +2238,24 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         ispec = getInteriorSpec(group);
         if (p && !ispec.hasInterior)
         {
-          QString containerGroup;
+          int containerGroup = -1;
           if (qobject_cast<QMenuBar*>(p))
           {
             if (mergedToolbarHeight(p))
-              containerGroup = "Toolbar";
+              containerGroup = ToolbarClass;
             else
-              containerGroup = "MenuBar";
+              containerGroup = MenuBarClass;
           }
           else if (QMenuBar *gp = qobject_cast<QMenuBar*>(getParent(p,1)))
           {
             if (mergedToolbarHeight(gp))
-              containerGroup = "Toolbar";
+              containerGroup = ToolbarClass;
             else
-              containerGroup = "MenuBar";
+              containerGroup = MenuBarClass;
           }
-          if (!containerGroup.isEmpty()
-              && enoughContrast(getFromRGBA(getLabelSpec(group).normalColor),
-                                getFromRGBA(getLabelSpec(containerGroup).normalColor)))
+          if (containerGroup >= 0
+              && enoughContrast(getLabelSpec(group).normalColor,
+                                getLabelSpec(containerGroup).normalColor))
           { // high contrast on menubar
             fillWidgetInterior = true;
           }
@@ -2033,7 +2263,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       }
 
       frame_spec fspec = getFrameSpec(group);
-      QString status = getState(option,widget);
+      int wState = getWidgetState(option,widget);
 
       /* prevent drawing pushbuttons as toolbuttons (as in QupZilla or KNotes) */
       if (const QPushButton *pb = qobject_cast<const QPushButton*>(widget))
@@ -2041,7 +2271,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         fspec.expansion = 0;
         if (pb->text().isEmpty())
         {
-          painter->fillRect(option->rect, option->palette.brush(status.contains("-inactive")
+          painter->fillRect(option->rect, option->palette.brush(isInactiveState(wState)
                                                                   ? QPalette::Inactive
                                                                   : QPalette::Active,
                                                                 QPalette::Button));
@@ -2053,16 +2283,17 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
          comboboxes and buttons will have the WA_UnderMouse attribute without the cursor
          being over them. Hence we use the following logic in several places. It will
          be harmless if the bug is fixed. */
-      if (status.startsWith("focused")
+      if (baseState(wState) == FocusedState
           && widget && !widget->rect().contains(widget->mapFromGlobal(QCursor::pos())))
       {
-        status.replace("focused","normal");
+        wState = (wState & InactiveState) | NormalState;
       }
 
       bool hasPanel = false;
 
-      indicator_spec dspec = getIndicatorSpec(group);
-      label_spec lspec = getLabelSpec(group);
+      const widget_specs &specs = getWidgetSpecs(group);
+      indicator_spec dspec = specs.dspec;
+      label_spec lspec = labelSpec(specs);
       QRect r = option->rect;
 
       const QToolButton *tb = qobject_cast<const QToolButton*>(widget);
@@ -2081,13 +2312,13 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       }*/
       if (widget && widget->inherits("QDockWidgetTitleButton"))
       {
-        if (status.startsWith("focused"))
+        if (baseState(wState) == FocusedState)
         {
           QColor col = widget->palette().color(QPalette::Active,QPalette::Highlight);
           col.setAlpha(50);
           painter->fillRect(r,col);
         }
-        else if (status.startsWith("pressed"))
+        else if (baseState(wState) == PressedState)
         {
           QColor col = widget->palette().color(QPalette::Active,QPalette::Highlight);
           painter->save();
@@ -2112,11 +2343,11 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           if (qobject_cast<QTabBar*>(p)) // tabbar scroll button
           {
             bool painterSaved = false;
-            painter->fillRect(option->rect, standardPalette().color(status.contains("-inactive")
+            painter->fillRect(option->rect, standardPalette().color(isInactiveState(wState)
                                                                       ? QPalette::Inactive
                                                                       : QPalette::Active,
                                                                     QPalette::Window));
-            const frame_spec fspec1 = getFrameSpec(QStringLiteral("Tab"));
+            const frame_spec fspec1 = getFrameSpec(TabClass);
             fspec.left = qMin(fspec.left, fspec1.left);
             fspec.right = qMin(fspec.right, fspec1.right);
             fspec.top = qMin(fspec.top, fspec1.top);
@@ -2154,11 +2385,11 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
             }
             /* don't accept any state because some themes
                may not have SVG elements suitable for grouping */
-            status = "normal";
+            wState = NormalState;
             if (isWidgetInactive(widget))
-              status.append("-inactive");
-            renderFrame(painter,r,fspec,fspec.element+"-"+status);
-            renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status);
+              wState |= InactiveState;
+            renderFrame(painter,r,fspec,fspec.elementId,wState);
+            renderInterior(painter,r,fspec,ispec,ispec.elementId,wState);
             if(painterSaved)
               painter->restore();
             if (!paneledButtons.contains(widget))
@@ -2218,11 +2449,11 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       bool drawSep(false);
       if (!(option->state & State_Enabled))
       {
-        status = "normal";
+        wState = NormalState;
         if (option->state & State_On)
-          status = "toggled";
+          wState = ToggledState;
         if (isInactive)
-          status.append("-inactive");
+          wState |= InactiveState;
         painter->save();
         painter->setOpacity(DISABLED_OPACITY);
       }
@@ -2231,9 +2462,9 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         /* always show menu titles in the toggled state */
         if (!hspec_.transparent_menutitle
             && tb->isDown() && tb->toolButtonStyle() == Qt::ToolButtonTextBesideIcon
-            && qobject_cast<QMenu*>(p))
+            && qobject_cast<QMenu*>(p) && baseState(wState) == PressedState)
         {
-          status.replace("pressed","toggled");
+          wState = (wState & InactiveState) | ToggledState;
         }
 
         /* only group tool buttons whose immediate parent is a horizontal toolbar */
@@ -2322,7 +2553,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           }
           else
           {
-            const frame_spec fspec1 = getFrameSpec(QStringLiteral("DropDownButton"));
+            const frame_spec fspec1 = getFrameSpec(DropDownButtonClass);
             if (tb->width() < opt->iconSize.width()+fspec.left
                               +(rtl ? fspec1.left : fspec1.right)
                               +TOOL_BUTTON_ARROW_SIZE+2*TOOL_BUTTON_ARROW_MARGIN)
@@ -2398,12 +2629,10 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         }
 
         QObject *styleObject = option->styleObject;
-        QString animationStartState;
-        if (styleObject)
-          animationStartState = styleObject->property("_kv_state").toString();
+        const int animationStartState = animationStartStateOf(styleObject);
         bool animate(widget->isEnabled() && animatedWidget_ == widget
-                     && !animationStartState.isEmpty());
-        if (animate && animationStartState == status)
+                     && animationStartState != NoState);
+        if (animate && animationStartState == wState)
         {
           if (opacityTimer_->isActive())
             opacityTimer_->stop();
@@ -2412,80 +2641,82 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         }
         if (tb->autoRaise())
           autoraise = true;
-        if (!autoraise || !status.startsWith("normal") || drawRaised)
+        if (!autoraise || baseState(wState) != NormalState || drawRaised)
         {
           if (animate)
           {
             if (!opacityTimer_->isActive())
             {
               animationOpacity_ = 0;
-              opacityTimer_->start(ANIMATION_FRAME);
+              opacityTimer_->start();
             }
             if (animationOpacity_ < 100
-                && (!autoraise || !animationStartState.startsWith("normal") || drawRaised))
+                && (!autoraise || baseState(animationStartState) != NormalState || drawRaised))
             {
-              renderFrame(painter,r,fspec,fspec.element+"-"+animationStartState,0,0,0,0,0,drawRaised);
-              if (!fillWidgetInterior)
-                renderInterior(painter,r,fspec,ispec,ispec.element+"-"+animationStartState,drawRaised);
+              renderAnimatedPanel(painter,widget,r,fspec,ispec,animationStartState,
+                                  !fillWidgetInterior,drawRaised);
             }
             painter->save();
             painter->setOpacity(static_cast<qreal>(animationOpacity_)/100.0);
+            renderAnimatedPanel(painter,widget,r,fspec,ispec,wState,
+                                !fillWidgetInterior,drawRaised);
+          }
+          else
+          {
+            renderFrame(painter,r,fspec,fspec.elementId,wState,0,0,0,0,0,drawRaised);
+            if (!fillWidgetInterior)
+              renderInterior(painter,r,fspec,ispec,ispec.elementId,wState,drawRaised);
           }
-          renderFrame(painter,r,fspec,fspec.element+"-"+status,0,0,0,0,0,drawRaised);
-          if (!fillWidgetInterior)
-            renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status,drawRaised);
           if (animate)
           {
             painter->restore();
             if (animationOpacity_ >= 100)
-              styleObject->setProperty("_kv_state", status);
+              styleObject->setProperty("_kv_state", wState);
           }
           else if (styleObject)
-            styleObject->setProperty("_kv_state", status);
+            styleObject->setProperty("_kv_state", wState);
           if (fillWidgetInterior)
-            painter->fillRect(interiorRect(r,fspec), tb->palette().brush(status.contains("-inactive")
+            painter->fillRect(interiorRect(r,fspec), tb->palette().brush(isInactiveState(wState)
                                                                            ? QPalette::Inactive
                                                                            : QPalette::Active,
                                                                          QPalette::Button));
           hasPanel = true;
         }
         // auto-raised fade out animation
-        else if (animate && !animationStartState.startsWith("normal"))
+        else if (animate && baseState(animationStartState) != NormalState)
         {
           if (!opacityTimer_->isActive())
           {
             animationOpacity_ = 0;
-            opacityTimer_->start(ANIMATION_FRAME);
+            opacityTimer_->start();
           }
           if (animationOpacity_ < 100)
           {
             painter->save();
             painter->setOpacity(1.0 - static_cast<qreal>(animationOpacity_)/100.0);
-            renderFrame(painter,r,fspec,fspec.element+"-"+animationStartState);
-            if (!fillWidgetInterior)
-              renderInterior(painter,r,fspec,ispec,ispec.element+"-"+animationStartState);
+            renderAnimatedPanel(painter,widget,r,fspec,ispec,animationStartState,!fillWidgetInterior);
             painter->restore();
             if (fillWidgetInterior)
-              painter->fillRect(interiorRect(r,fspec), tb->palette().brush(status.contains("-inactive")
+              painter->fillRect(interiorRect(r,fspec), tb->palette().brush(isInactiveState(wState)
                                                                              ? QPalette::Inactive
                                                                              : QPalette::Active,
                                                                            QPalette::Button));
           }
           if (animationOpacity_ >= 100)
-            styleObject->setProperty("_kv_state", status);
+            styleObject->setProperty("_kv_state", wState);
         }
         else if (styleObject)
-          styleObject->setProperty("_kv_state", status);
+          styleObject->setProperty("_kv_state", wState);
 
         /*if (!isHorizontal && !withArrow)
           painter->restore();*/
       }
-      else if (!autoraise || !status.startsWith("normal"))
+      else if (!autoraise || baseState(wState) != NormalState)
       {
         bool libreoffice = false;
         if (isLibreoffice_ && widget == nullptr
-            && (option->state & State_Enabled) && !status.startsWith("toggled")
-            && enoughContrast(getFromRGBA(lspec.normalColor), standardPalette().color(QPalette::ButtonText)))
+            && (option->state & State_Enabled) && baseState(wState) != ToggledState
+            && enoughContrast(lspec.normalColor, standardPalette().color(QPalette::ButtonText)))
         {
           libreoffice = true;
           painter->fillRect(option->rect, standardPalette().brush(QPalette::Window));
@@ -2511,14 +2742,14 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                               option->palette.brush(QPalette::Active, QPalette::Button));
           }
           else
-            renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status);
+            renderInterior(painter,r,fspec,ispec,ispec.elementId,wState);
         }
         else // widget isn't null
-          painter->fillRect(interiorRect(r,fspec), widget->palette().brush(status.contains("-inactive")
+          painter->fillRect(interiorRect(r,fspec), widget->palette().brush(isInactiveState(wState)
                                                                              ? QPalette::Inactive
                                                                              : QPalette::Active,
                                                                            QPalette::Button));
-        renderFrame(painter,r,fspec,fspec.element+"-"+status);
+        renderFrame(painter,r,fspec,fspec.elementId,wState);
         if (libreoffice) painter->restore();
         hasPanel = true;
       }
@@ -2540,49 +2771,49 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         QColor col;
         if (hasPanel)
         {
-          if (status.startsWith("pressed"))
+          if (status.startsWith(QLatin1String("pressed")))
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.pressInactiveColor);
+              col = lspec.pressInactiveColor;
               if (!col.isValid())
-                col = getFromRGBA(lspec.pressColor);
+                col = lspec.pressColor;
             }
             else
-              col = getFromRGBA(lspec.pressColor);
+              col = lspec.pressColor;
           }
-          else if (status.startsWith("toggled"))
+          else if (status.startsWith(QLatin1String("toggled")))
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.toggleInactiveColor);
+              col = lspec.toggleInactiveColor;
               if (!col.isValid())
-                col = getFromRGBA(lspec.toggleColor);
+                col = lspec.toggleColor;
             }
             else
-              col = getFromRGBA(lspec.toggleColor);
+              col = lspec.toggleColor;
           }
           else if (option->state & State_MouseOver)
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.focusInactiveColor);
+              col = lspec.focusInactiveColor;
               if (!col.isValid())
-                col = getFromRGBA(lspec.focusColor);
+                col = lspec.focusColor;
             }
             else
-              col = getFromRGBA(lspec.focusColor);
+              col = lspec.focusColor;
           }
           else
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.normalInactiveColor);
+              col = lspec.normalInactiveColor;
               if (!col.isValid())
-                col = getFromRGBA(lspec.normalColor);
+                col = lspec.normalColor;
             }
             else
-              col = getFromRGBA(lspec.normalColor);
+              col = lspec.normalColor;
           }
 
           if (!col.isValid())
@@ -2644,7 +2875,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
     case PE_FrameButtonTool : {return;}
 
     case PE_IndicatorRadioButton : {
-      const interior_spec ispec = getInteriorSpec(QStringLiteral("RadioButton"));
+      const interior_spec ispec = getInteriorSpec(RadioButtonClass);
 
       if (option->state & State_Enabled)
       {
@@ -2693,7 +2924,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           if (!opacityTimer_->isActive())
           {
             animationOpacity_ = 0;
-            opacityTimer_->start(ANIMATION_FRAME);
+            opacityTimer_->start();
           }
           if (animationOpacity_ < 100)
             renderElement(painter, ispec.element+animationStartState, option->rect);
@@ -2737,7 +2968,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
     }
 
     case PE_IndicatorCheckBox : {
-      const interior_spec ispec = getInteriorSpec(QStringLiteral("CheckBox"));
+      const interior_spec ispec = getInteriorSpec(CheckBoxClass);
 
       if (option->state & State_Enabled)
       {
@@ -2828,7 +3059,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           if (!opacityTimer_->isActive())
           {
             animationOpacity_ = 0;
-            opacityTimer_->start(ANIMATION_FRAME);
+            opacityTimer_->start();
           }
           if (animationOpacity_ < 100)
             renderElement(painter, ispec.element+animationStartState, option->rect);
@@ -2894,7 +3125,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         fspec.right = qMin(fspec.right,2);
         fspec.top = qMin(fspec.top,2);
         fspec.bottom = qMin(fspec.bottom,2);
-        renderFrame(painter,option->rect,fspec,fspec.element);
+        renderFrame(painter,option->rect,fspec,fspec.elementId,NoState);
       }
 
       break;
@@ -2912,7 +3143,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         default_frame_spec(fspec);
 
 
-        QString status = getState(option,widget);
+        const int wState = getWidgetState(option,widget);
         QString eStatus = "normal";
         /* some apps (like Dolphin) don't set the state to enabled; moreover,
            we don't consider the disabled state in drawing branch lines either */
@@ -2920,7 +3151,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           eStatus = "disabled";
         else */if (option->state & State_MouseOver)
           eStatus = "focused";
-        else if (status.startsWith("toggled") || status.startsWith("pressed"))
+        else if (baseState(wState) == ToggledState || baseState(wState) == PressedState)
           eStatus = "pressed";
         if (isWidgetInactive(widget))
           eStatus.append("-inactive");
@@ -3011,7 +3242,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           /*|| isLibreoffice_*/) // LibreOffice's menus can be styled but not well
         break;
 
-      const QString group = "Menu";
+      const int group = MenuClass;
       frame_spec fspec = getFrameSpec(group);
       fspec.expansion = 0;
       const interior_spec ispec = getInteriorSpec(group);
@@ -3058,14 +3289,14 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           renderFrame(painter,r,fspec,fspec.element+"-shadow");
           painter->restore();
 
-          if (!renderInterior(painter,r,fspec,ispec,ispec.element+"-normal"))
+          if (!renderInterior(painter,r,fspec,ispec,ispec.elementId,NormalState))
             painter->fillRect(interiorRect(r,fspec), standardPalette().color(QPalette::Window));
           painter->restore();
         }
         else
         {
           renderFrame(painter,r,fspec,fspec.element+"-shadow");
-          if (!renderInterior(painter,r,fspec,ispec,ispec.element+"-normal"))
+          if (!renderInterior(painter,r,fspec,ispec,ispec.elementId,NormalState))
             painter->fillRect(interiorRect(r,fspec), standardPalette().color(QPalette::Window));
         }
       }
@@ -3076,9 +3307,9 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           painter->save();
           painter->setOpacity(1.0 - static_cast<qreal>(tspec_.reduce_menu_opacity)/100.0);
         }
-        if (!widget || !renderInterior(painter,r,fspec,ispec,ispec.element+"-normal")) // QML
+        if (!widget || !renderInterior(painter,r,fspec,ispec,ispec.elementId,NormalState)) // QML
           painter->fillRect(r, standardPalette().color(QPalette::Window));
-        renderFrame(painter,r,fspec,fspec.element+"-normal");
+        renderFrame(painter,r,fspec,fspec.elementId,NormalState);
         if (isTranslucent)
           painter->restore();
       }
@@ -3148,7 +3379,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                     != standardPalette().color(QPalette::Active,QPalette::Base))
                 {
                    pcmanfmInactiveView = true;
-                   painter->fillRect(interiorRect(option->rect,getFrameSpec(QStringLiteral("GenericFrame"))),
+                   painter->fillRect(interiorRect(option->rect,getFrameSpec(GenericFrameClass)),
                                      standardPalette().color(isWidgetInactive(widget)
                                                                ? QPalette::Inactive
                                                                : QPalette::Active,
@@ -3167,7 +3398,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         if (widget && widget->inherits("QComboBoxPrivateContainer")
             && tspec_.combo_menu /*&& !isLibreoffice_*/)
         { // as with PE_PanelMenu FIXME: calling it instead?
-          const QString group = "Menu";
+          const int group = MenuClass;
           frame_spec fspec = getFrameSpec(group);
           fspec.expansion = 0;
           const interior_spec ispec = getInteriorSpec(group);
@@ -3211,14 +3442,14 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
               renderFrame(painter,r,fspec,fspec.element+"-shadow");
               painter->restore();
 
-              if (!renderInterior(painter,r,fspec,ispec,ispec.element+"-normal"))
+              if (!renderInterior(painter,r,fspec,ispec,ispec.elementId,NormalState))
                 painter->fillRect(interiorRect(r,fspec), standardPalette().color(QPalette::Window));
               painter->restore();
             }
             else
             {
               renderFrame(painter,r,fspec,fspec.element+"-shadow");
-              if (!renderInterior(painter,r,fspec,ispec,ispec.element+"-normal"))
+              if (!renderInterior(painter,r,fspec,ispec,ispec.elementId,NormalState))
                 painter->fillRect(interiorRect(r,fspec), standardPalette().color(QPalette::Window));
             }
           }
@@ -3231,9 +3462,9 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
             }
             else // we enforced translucency on the combo menu at polish(QWidget*)
               painter->fillRect(r, standardPalette().color(QPalette::Window));
-            if (!renderInterior(painter,r,fspec,ispec,ispec.element+"-normal") && isTranslucent)
+            if (!renderInterior(painter,r,fspec,ispec,ispec.elementId,NormalState) && isTranslucent)
               painter->fillRect(r, standardPalette().color(QPalette::Window));
-            renderFrame(painter,r,fspec,fspec.element+"-normal");
+            renderFrame(painter,r,fspec,fspec.elementId,NormalState);
             if (isTranslucent)
               painter->restore();
           }
@@ -3249,7 +3480,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                                || sa->viewport()->backgroundRole() == QPalette::Button));
         if (!hasFlatBg && tspec_.remove_extra_frames) break;
 
-        frame_spec fspec = getFrameSpec(QStringLiteral("GenericFrame"));
+        frame_spec fspec = getFrameSpec(GenericFrameClass);
         fspec.expansion = 0;
 
         if (!(option->state & State_Enabled))
@@ -3257,15 +3488,15 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           painter->save();
           painter->setOpacity(DISABLED_OPACITY);
         }
-        QString fStatus = "normal";
+        int fState = NormalState;
         if (widget && widget->hasFocus() && hasFlatBg
             && !widget->inherits("QWellArray") // color rects always have focus!
             && elementExists(fspec.element+"-focused-top"))
         {
-          fStatus = "focused";
+          fState = FocusedState;
         }
         if (isWidgetInactive(widget))
-          fStatus = "normal-inactive"; // the focus state is meaningless here
+          fState = NormalState | InactiveState; // the focus state is meaningless here
         if (!widget) // QML again!
         {
           QColor baseCol = standardPalette().color(QPalette::Base);
@@ -3274,40 +3505,40 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         }
         bool animate(!pcmanfmInactiveView
                      && widget && widget->isEnabled()
-                     && ((animatedWidget_ == widget && !fStatus.startsWith("normal"))
-                         || (animatedWidgetOut_ == widget && fStatus.startsWith("normal"))));
-        QString animationStartState(animationStartState_);
+                     && ((animatedWidget_ == widget && baseState(fState) != NormalState)
+                         || (animatedWidgetOut_ == widget && baseState(fState) == NormalState)));
+        int animationStartState = animationStartState_;
         int animationOpacity = animationOpacity_;
         if (animate)
         {
-          if (fStatus.startsWith("normal")) // -> QEvent::FocusOut
+          if (baseState(fState) == NormalState) // -> QEvent::FocusOut
           {
             animationStartState = animationStartStateOut_;
             animationOpacity = animationOpacityOut_;
           }
-          if (animationStartState == fStatus)
+          if (animationStartState == fState)
           {
             animationOpacity = 100;
-            if (fStatus.startsWith("normal"))
+            if (baseState(fState) == NormalState)
               animationOpacityOut_ = 100;
             else
               animationOpacity_ = 100;
           }
           else if (animationOpacity < 100)
-            renderFrame(painter,option->rect,fspec,fspec.element+"-"+animationStartState);
+            renderFrame(painter,option->rect,fspec,fspec.elementId,animationStartState);
           painter->save();
           painter->setOpacity(static_cast<qreal>(animationOpacity)/100.0);
         }
-        renderFrame(painter,option->rect,fspec,fspec.element+"-"+fStatus);
+        renderFrame(painter,option->rect,fspec,fspec.elementId,fState);
         if (animate)
         {
           painter->restore();
           if (animationOpacity >= 100)
           {
-            if (fStatus.startsWith("normal"))
-              animationStartStateOut_ = fStatus;
+            if (baseState(fState) == NormalState)
+              animationStartStateOut_ = fState;
             else
-              animationStartState_ = fStatus;
+              animationStartState_ = fState;
           }
         }
         if (!(option->state & State_Enabled))
@@ -3358,9 +3589,10 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       {
         if (frame->features & QStyleOptionFrame::Flat)
           break;
-        const QString group = "GroupBox";
-        frame_spec fspec = getFrameSpec(group);
-        const interior_spec ispec = getInteriorSpec(group);
+        const int group = GroupBoxClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        const interior_spec &ispec = specs.ispec;
         if (!tspec_.groupbox_top_label
             || !widget) // WARNING: QML has anchoring!
           fspec.expansion = 0;
@@ -3385,9 +3617,10 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
     }
 
     case PE_FrameTabWidget : {
-      const QString group = "TabFrame";
-      frame_spec fspec = getFrameSpec(group);
-      const interior_spec ispec = getInteriorSpec(group);
+      const int group = TabFrameClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      frame_spec fspec = specs.fspec;
+      const interior_spec &ispec = specs.ispec;
 
       frame_spec fspec1 = fspec;
       int d = 0;
@@ -3491,7 +3724,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           painter->restore();
         }
       }
-      const frame_spec fspecT = getFrameSpec(QStringLiteral("Tab"));
+      const frame_spec fspecT = getFrameSpec(TabClass);
       renderFrame(painter,
                   option->rect,
                   fspec,fspec.element+suffix,
@@ -3518,19 +3751,20 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       if (qobject_cast<const QLineEdit*>(widget) && qobject_cast<QComboBox*>(p))
         break;
 
-      QString group;
-      if ((!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-           || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+      int group;
+      if ((!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+           || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
           && getStylableToolbarContainer(widget, true)
           && !enoughContrast(widget->palette().color(QPalette::Active, QPalette::Text),
-                             getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
+                             getLabelSpec(ToolbarClass).normalColor))
       {
-        group = "ToolbarLineEdit";
+        group = ToolbarLineEditClass;
       }
       else
-        group = "LineEdit";
-      interior_spec ispec = getInteriorSpec(group);
-      frame_spec fspec = getFrameSpec(group);
+        group = LineEditClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      interior_spec ispec = specs.ispec;
+      frame_spec fspec = specs.fspec;
 
       /* always draw a thin frame when editing itemview texts */
       if (qobject_cast<QAbstractItemView*>(getParent(p,1)))
@@ -3542,7 +3776,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         fspec.left = fspec.right = fspec.top = fspec.bottom = 1;
         fspec.expansion = 0;
         if (ispec.hasInterior)
-          renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-focused");
+          renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,FocusedState);
         else
         {
           QColor baseCol = widget->palette().color(QPalette::Base);
@@ -3582,7 +3816,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       }*/
       else if (qobject_cast<const QLineEdit*>(widget))
       {
-        colored = !insideSpinBox && group == "LineEdit"
+        colored = !insideSpinBox && group == LineEditClass
                   && widget->palette().color(QPalette::Base) != standardPalette().color(QPalette::Base);
         if (colored
             || (
@@ -3644,7 +3878,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                                         + (sb->buttonSymbols() == QAbstractSpinBox::NoButtons ? fspec.right : 0)
               || (sb->buttonSymbols() != QAbstractSpinBox::NoButtons
                   && sb->width() < widget->width() + 2*tspec_.spin_button_width
-                                                   + getFrameSpec(QStringLiteral("IndicatorSpinBox")).right)
+                                                   + getFrameSpec(IndicatorSpinBoxClass).right)
               || sb->height() < fspec.top+fspec.bottom+QFontMetrics(widget->font()).height())
           {
             fspec.left = qMin(fspec.left,3);
@@ -3670,7 +3904,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         /* see if there is any icon on the left of the combo box (for LTR) */
         if (option->direction == Qt::RightToLeft)
         {
-          int arrowFrameSize = tspec_.combo_as_lineedit ? fspec.left : getFrameSpec(QStringLiteral("ComboBox")).left;
+          int arrowFrameSize = tspec_.combo_as_lineedit ? fspec.left : getFrameSpec(ComboBoxClass).left;
           if (widget->width() < p->width()
                                - (tspec_.square_combo_button
                                   ? qMax(COMBO_ARROW_LENGTH, p->height()-arrowFrameSize)
@@ -3695,44 +3929,44 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                                                                   : standardPalette().color(QPalette::Text))));
 
       // lineedits only have normal and focused states in Kvantum
-      QString leStatus = (option->state & State_HasFocus) ? "focused" : "normal";
+      int leState = (option->state & State_HasFocus) ? FocusedState : NormalState;
       if (isWidgetInactive(widget))
-        leStatus.append("-inactive");
+        leState |= InactiveState;
       if (!(option->state & State_Enabled))
       {
         painter->save();
         painter->setOpacity(DISABLED_OPACITY);
       }
       bool animateSpin(qobject_cast<QAbstractSpinBox*>(p)
-                       && ((animatedWidget_ == p && !leStatus.startsWith("normal"))
-                           || (animatedWidgetOut_ == p && leStatus.startsWith("normal"))));
+                       && ((animatedWidget_ == p && baseState(leState) != NormalState)
+                           || (animatedWidgetOut_ == p && baseState(leState) == NormalState)));
       bool animate(/*!isLibreoffice_ &&*/ widget && widget->isEnabled()
                    && !qobject_cast<const QAbstractScrollArea*>(widget)
-                   && ((animatedWidget_ == widget && !leStatus.startsWith("normal"))
-                       || (animatedWidgetOut_ == widget && leStatus.startsWith("normal"))
+                   && ((animatedWidget_ == widget && baseState(leState) != NormalState)
+                       || (animatedWidgetOut_ == widget && baseState(leState) == NormalState)
                        || animateSpin));
-      QString animationStartState(animationStartState_);
+      int animationStartState = animationStartState_;
       int animationOpacity = animationOpacity_;
       if (animate)
       {
-        if (leStatus.startsWith("normal")) // -> QEvent::FocusOut
+        if (baseState(leState) == NormalState) // -> QEvent::FocusOut
         {
           animationStartState = animationStartStateOut_;
           animationOpacity = animationOpacityOut_;
         }
-        if (animationStartState == leStatus)
+        if (animationStartState == leState)
         {
           animationOpacity = 100;
-          if (leStatus.startsWith("normal"))
+          if (baseState(leState) == NormalState)
             animationOpacityOut_ = 100;
           else
             animationOpacity_ = 100;
         }
         else if (animationOpacity < 100)
         {
-          renderFrame(painter,option->rect,fspec,fspec.element+"-"+animationStartState);
+          renderFrame(painter,option->rect,fspec,fspec.elementId,animationStartState);
           if (!fillWidgetInterior)
-            renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+animationStartState);
+            renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,animationStartState);
         }
         painter->save();
         painter->setOpacity(static_cast<qreal>(animationOpacity)/100.0);
@@ -3743,23 +3977,23 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                     option->rect.adjusted(fspec.left,fspec.top,-fspec.right,-fspec.bottom) :*/
                     option->rect,
                   fspec,
-                  fspec.element+"-"+leStatus);
+                  fspec.elementId,leState);
       if (!fillWidgetInterior)
-        renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+leStatus);
+        renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,leState);
       if (animate)
       {
         painter->restore();
         if (animationOpacity >= 100)
         {
-          if (leStatus.startsWith("normal"))
-            animationStartStateOut_ = leStatus;
+          if (baseState(leState) == NormalState)
+            animationStartStateOut_ = leState;
           else
-            animationStartState_ = leStatus;
+            animationStartState_ = leState;
         }
       }
       if (fillWidgetInterior) // widget isn't null
       {
-        QColor baseCol = widget->palette().color(leStatus.contains("-inactive")
+        QColor baseCol = widget->palette().color(isInactiveState(leState)
                                                    ? QPalette::Inactive
                                                    : QPalette::Active,
                                                  QPalette::Base);
@@ -3779,7 +4013,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
 
     case PE_IndicatorToolBarHandle :
     case PE_IndicatorToolBarSeparator : {
-      const QString group = "Toolbar";
+      const int group = ToolbarClass;
 
       frame_spec fspec;
       default_frame_spec(fspec);
@@ -3836,7 +4070,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       if (element == PE_IndicatorSpinMinus || element == PE_IndicatorSpinDown)
         up = false;
 
-      const QString group = "IndicatorSpinBox";
+      const int group = IndicatorSpinBoxClass;
       const QStyleOptionSpinBox *opt = qstyleoption_cast<const QStyleOptionSpinBox*>(option);
       // the measure we used in CC_SpinBox at drawComplexControl() (for QML)
       bool verticalIndicators(tspec_.vertical_spin_indicators || (!widget && opt && opt->frame));
@@ -3853,13 +4087,13 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           fspec.HPos = 0;
         if (tspec_.inline_spin_indicators)
         { // only when there is enough space for the line-edit (-> SE_LineEditContents)
-          const label_spec lspec = getLabelSpec(QStringLiteral("LineEdit"));
+          const label_spec lspec = getLabelSpec(LineEditClass);
           vOffset = (lspec.bottom-lspec.top)/2;
           if (vOffset != 0
               && option->rect.height() < sizeCalculated(widget ? widget->font() : painter->font(),
-                                                        getFrameSpec(QStringLiteral("LineEdit")),
+                                                        getFrameSpec(LineEditClass),
                                                         lspec,
-                                                        getSizeSpec(QStringLiteral("LineEdit")),
+                                                        getSizeSpec(LineEditClass),
                                                         QStringLiteral("W"),QSize()).height())
           {
             vOffset = 0;
@@ -3906,7 +4140,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       }
       else
       {
-        fspec = getFrameSpec(QStringLiteral("LineEdit"));
+        fspec = getFrameSpec(LineEditClass);
         fspec.left = qMin(fspec.left,3);
         fspec.right = qMin(fspec.right,3);
         fspec.top = qMin(fspec.top,3);
@@ -3927,8 +4161,9 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         fspec.expansion = 0;
       } */
 
-      QString iStatus = getState(option,widget);; // indicator state
-      QString bStatus = iStatus; // button state
+      const int wState = getWidgetState(option,widget);
+      QString iStatus = stateName(wState); // indicator state
+      int bState = wState; // button state
       if (option->state & State_Enabled)
       {
         if (opt)
@@ -3954,21 +4189,20 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
 
           // press or focus only the active button
           if (opt->activeSubControls != sc)
-            bStatus = "normal";
+            bState = NormalState;
         }
         // disable only the indicator, not the button
         if (iStatus == "disabled")
-          bStatus = "normal";
+          bState = NormalState;
         // don't focus the indicator when the cursor isn't on the button
-        else if (bStatus.startsWith("normal"))
+        else if (baseState(bState) == NormalState)
           iStatus = "normal";
 
         if (isWidgetInactive(widget))
         {
-          if (!iStatus.endsWith("-inactive"))
+          if (!iStatus.endsWith(QLatin1String("-inactive")))
             iStatus.append("-inactive");
-          if (!bStatus.endsWith("-inactive"))
-            bStatus.append("-inactive");
+          bState |= InactiveState;
         }
       }
 
@@ -3992,9 +4226,9 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
 
       if (!verticalIndicators && (!tspec_.inline_spin_indicators || tspec_.inline_spin_separator))
       {
-        if (bStatus.startsWith("disabled"))
+        if (baseState(bState) == DisabledState)
         {
-          bStatus.replace("disabled","normal");
+          bState = (bState & InactiveState) | NormalState;
           painter->save();
           painter->setOpacity(DISABLED_OPACITY);
         }
@@ -4002,20 +4236,20 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         {
           interior_spec ispec = getInteriorSpec(group);
           ispec.px = ispec.py = 0;
-          renderFrame(painter,r,fspec,fspec.element+"-"+bStatus,0,0,0,0,0,true);
-          renderInterior(painter,r,fspec,ispec,ispec.element+"-"+bStatus,true);
+          renderFrame(painter,r,fspec,fspec.elementId,bState,0,0,0,0,0,true);
+          renderInterior(painter,r,fspec,ispec,ispec.elementId,bState,true);
         }
         if (element == PE_IndicatorSpinDown || element == PE_IndicatorSpinMinus)
         { // draw spinbox separator if it exists
-          QString sepName = dspec.element + "-separator";
+          const int sepId = suffixElementId(dspec.elementId,SeparatorSuffix);
           QRect sep;
           sep.setRect(x, y+fspec.top, fspec.left, h-fspec.top-fspec.bottom);
-          if (renderElement(painter, sepName+"-"+bStatus, sep))
+          if (renderElement(painter, stateElementId(sepId,bState), sep))
           {
             sep.adjust(0, -fspec.top, 0, -h+fspec.top+fspec.bottom);
-            renderElement(painter, sepName+"-top-"+bStatus, sep);
+            renderElement(painter, stateElementId(suffixElementId(sepId,TopSuffix),bState), sep);
             sep.adjust(0, h-fspec.bottom, 0, h-fspec.top);
-            renderElement(painter, sepName+"-bottom-"+bStatus, sep);
+            renderElement(painter, stateElementId(suffixElementId(sepId,BottomSuffix),bState), sep);
           }
         }
         if (!(option->state & State_Enabled))
@@ -4036,26 +4270,26 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       if ((verticalIndicators || tspec_.inline_spin_indicators)
           && themeRndr_ && themeRndr_->isValid())
       {
-        QColor col = getFromRGBA(getLabelSpec(group).normalColor);
+        QColor col = getLabelSpec(group).normalColor;
         if (!col.isValid())
           col = standardPalette().color(QPalette::ButtonText);
         if (enoughContrast(col, standardPalette().color(QPalette::Text))
             && flatArrowExists(dspec.element))
-          dspec.element = "flat-"+dspec.element;
+          setSpecElement(dspec, "flat-"+dspec.element);
 
-        if ((!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-             || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+        if ((!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+             || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
             && getStylableToolbarContainer(widget, true))
         {
-          QColor tCol = getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor);
+          QColor tCol = getLabelSpec(ToolbarClass).normalColor;
           QLineEdit *le = widget->findChild<QLineEdit*>();
           if (enoughContrast(standardPalette().color(QPalette::Active,QPalette::Text), tCol)
               && !enoughContrast(le->palette().color(QPalette::Active, QPalette::Text), tCol))
           {
             if (dspec.element.startsWith("flat-"))
-              dspec.element.remove(0, 5);
+              setSpecElement(dspec, dspec.element.mid(5));
             else
-              dspec.element = "flat-"+dspec.element;;
+              setSpecElement(dspec, "flat-"+dspec.element);
           }
         }
       }
@@ -4075,10 +4309,11 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         qstyleoption_cast<const QStyleOptionHeader*>(option);
       if (opt)
       {
-        const QString group = "HeaderSection";
-        frame_spec fspec = getFrameSpec(group);
-        const indicator_spec dspec = getIndicatorSpec(group);
-        const label_spec lspec = getLabelSpec(group);
+        const int group = HeaderSectionClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        const indicator_spec &dspec = specs.dspec;
+        const label_spec &lspec = labelSpec(specs);
 
         /* this is compensated in CE_HeaderLabel;
            also see SE_HeaderArrow */
@@ -4096,10 +4331,10 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         QString aStatus = getState(option,widget);
         /* distinguish between the toggled and pressed states
            only if a toggled down arrow element exists */
-        if (aStatus.startsWith("toggled"))
+        if (aStatus.startsWith(QLatin1String("toggled")))
         {
           if (!elementExists(dspec.element+"-down-toggled"))
-            aStatus.replace("toggled","pressed");
+            aStatus.replace(QLatin1String("toggled"),QLatin1String("pressed"));
         }
         if (opt->sortIndicator == QStyleOptionHeader::SortDown)
           renderIndicator(painter,option->rect,fspec,dspec,dspec.element+"-down-"+aStatus,option->direction);
@@ -4114,7 +4349,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       QRect r = option->rect;
       interior_spec ispec;
       int vOffset = 0;
-      QString group = "DropDownButton";
+      int group = DropDownButtonClass;
       bool fillWidgetInterior(false);
 
       const QToolButton *tb = qobject_cast<const QToolButton*>(widget);
@@ -4128,15 +4363,15 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         if (stb)
         {
           autoraise = true;
-          if (!getFrameSpec(QStringLiteral("ToolbarButton")).element.isEmpty()
-              || !getInteriorSpec(QStringLiteral("ToolbarButton")).element.isEmpty())
+          if (!getFrameSpec(ToolbarButtonClass).element.isEmpty()
+              || !getInteriorSpec(ToolbarButtonClass).element.isEmpty())
           {
-            group = "ToolbarButton";
+            group = ToolbarButtonClass;
           }
           ispec = getInteriorSpec(group);
           if (!ispec.hasInterior
-              && enoughContrast(getFromRGBA(getLabelSpec(group).normalColor),
-                                getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
+              && enoughContrast(getLabelSpec(group).normalColor,
+                                getLabelSpec(ToolbarClass).normalColor))
           { // high contrast on toolbar
             fillWidgetInterior = true;
           }
@@ -4146,30 +4381,30 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           ispec = getInteriorSpec(group);
           if (p && !ispec.hasInterior)
           {
-            QString containerGroup;
+            int containerGroup = -1;
             if (qobject_cast<QMenuBar*>(p))
             {
               if (mergedToolbarHeight(p))
-                containerGroup = "Toolbar";
+                containerGroup = ToolbarClass;
               else
-                containerGroup = "MenuBar";
+                containerGroup = MenuBarClass;
             }
             else if (QMenuBar *gp = qobject_cast<QMenuBar*>(getParent(p,1)))
             {
               if (mergedToolbarHeight(gp))
-                containerGroup = "Toolbar";
+                containerGroup = ToolbarClass;
               else
-                containerGroup = "MenuBar";
+                containerGroup = MenuBarClass;
             }
-            if (!containerGroup.isEmpty()
-                && enoughContrast(getFromRGBA(getLabelSpec(group).normalColor),
-                                  getFromRGBA(getLabelSpec(containerGroup).normalColor)))
+            if (containerGroup >= 0
+                && enoughContrast(getLabelSpec(group).normalColor,
+                                  getLabelSpec(containerGroup).normalColor))
             { // high contrast on menubar
               fillWidgetInterior = true;
             }
           }
         }
-        const label_spec lspec = getLabelSpec(QStringLiteral("PanelButtonTool"));
+        const label_spec lspec = getLabelSpec(PanelButtonToolClass);
         vOffset = (lspec.bottom-lspec.top)/2;
       }
       else
@@ -4178,61 +4413,61 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       frame_spec fspec = getFrameSpec(group);
       fspec.expansion = 0; // depends on the containing widget
       indicator_spec dspec = getIndicatorSpec(group);
-      if (group == "ToolbarButton")
-        dspec.element += "-down";
+      if (group == ToolbarButtonClass)
+        setSpecElement(dspec, dspec.element+"-down");
 
-      QString status = getState(option,widget);
+      int wState = getWidgetState(option,widget);
       bool rtl(option->direction == Qt::RightToLeft);
 
       const QStyleOptionComboBox *combo =
             qstyleoption_cast<const QStyleOptionComboBox*>(option);
       const QComboBox *cb = qobject_cast<const QComboBox*>(widget);
 
-      QString cGroup;
-      if ((!getFrameSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty()
-           || !getInteriorSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty())
+      int cGroup;
+      if ((!getFrameSpec(ToolbarComboBoxClass).element.isEmpty()
+           || !getInteriorSpec(ToolbarComboBoxClass).element.isEmpty())
           && getStylableToolbarContainer(cb, true))
       {
-        cGroup = "ToolbarComboBox";
+        cGroup = ToolbarComboBoxClass;
       }
-      else cGroup = "ComboBox";
+      else cGroup = ComboBoxClass;
 
       if (cb /*&& !cb->duplicatesEnabled()*/)
       {
         if (tspec_.combo_as_lineedit && combo && combo->editable && cb->lineEdit())
         {
-          if ((!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-               || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+          if ((!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+               || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
               && getStylableToolbarContainer(cb->lineEdit(), true)
               && !enoughContrast(cb->lineEdit()->palette().color(QPalette::Active, QPalette::Text),
-                                 getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
+                                 getLabelSpec(ToolbarClass).normalColor))
           {
-            fspec = getFrameSpec(QStringLiteral("ToolbarLineEdit"));
-            ispec = getInteriorSpec(QStringLiteral("ToolbarLineEdit"));
-            indicator_spec dspec1 = getIndicatorSpec(QStringLiteral("ToolbarLineEdit"));
+            fspec = getFrameSpec(ToolbarLineEditClass);
+            ispec = getInteriorSpec(ToolbarLineEditClass);
+            indicator_spec dspec1 = getIndicatorSpec(ToolbarLineEditClass);
             if (elementExists(dspec1.element+"-normal"))
               dspec = dspec1;
             else
             { // fall back to LineEdit for backward compatibility
-              dspec1 = getIndicatorSpec(QStringLiteral("LineEdit"));
+              dspec1 = getIndicatorSpec(LineEditClass);
               if (elementExists(dspec1.element+"-normal"))
                 dspec = dspec1;
             }
             if (enoughContrast(standardPalette().color(QPalette::Active,QPalette::Text),
-                               getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
+                               getLabelSpec(ToolbarClass).normalColor))
             {
-              dspec.element = "flat-"+dspec.element;
+              setSpecElement(dspec, "flat-"+dspec.element);
             }
           }
           else
           {
-            fspec = getFrameSpec(QStringLiteral("LineEdit"));
-            ispec = getInteriorSpec(QStringLiteral("LineEdit"));
-            const indicator_spec dspec1 = getIndicatorSpec(QStringLiteral("LineEdit"));
+            fspec = getFrameSpec(LineEditClass);
+            ispec = getInteriorSpec(LineEditClass);
+            const indicator_spec dspec1 = getIndicatorSpec(LineEditClass);
             if (elementExists(dspec1.element+"-normal"))
               dspec = dspec1;
           }
-          const label_spec lspec = getLabelSpec(QStringLiteral("LineEdit"));
+          const label_spec lspec = getLabelSpec(LineEditClass);
           vOffset = (lspec.bottom-lspec.top)/2;
         }
         else
@@ -4245,7 +4480,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           {
             dspec = dspec1;
           }
-          const label_spec lspec = getLabelSpec(QStringLiteral("ComboBox"));
+          const label_spec lspec = getLabelSpec(ComboBoxClass);
           vOffset = (lspec.bottom-lspec.top)/2;
         }
 
@@ -4260,29 +4495,29 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
             fspec.HPos = 1;
         }
 
-        status = (option->state & State_Enabled) ?
-                  (option->state & State_On) ? "toggled" :
-                  ((option->state & State_Sunken) || cb->hasFocus()) ? "pressed" :
-                  (option->state & State_MouseOver) ? "focused" : "normal"
-                : "disabled";
+        wState = (option->state & State_Enabled) ?
+                  (option->state & State_On) ? ToggledState :
+                  ((option->state & State_Sunken) || cb->hasFocus()) ? PressedState :
+                  (option->state & State_MouseOver) ? FocusedState : NormalState
+                : DisabledState;
         if (isWidgetInactive(widget))
-          status.append("-inactive");
+          wState |= InactiveState;
 
         if ((combo && !combo->editable) || !cb->lineEdit())
         {
           /* in this case, the state definition isn't the usual one */
-          status = (option->state & State_Enabled) ?
-                    (option->state & State_On) ? "toggled" :
+          wState = (option->state & State_Enabled) ?
+                    (option->state & State_On) ? ToggledState :
                     (option->state & State_MouseOver)
                       && widget->rect().contains(widget->mapFromGlobal(QCursor::pos())) // hover bug
-                    ? "focused" :
+                    ? FocusedState :
                     (option->state & State_Sunken)
-                    || (option->state & State_Selected) ? "pressed" : "normal"
-                   : "disabled";
+                    || (option->state & State_Selected) ? PressedState : NormalState
+                   : DisabledState;
           if (isWidgetInactive(widget))
-            status.append("-inactive");
+            wState |= InactiveState;
           /* when there isn't enough space */
-          const label_spec lspec1 = getLabelSpec(QStringLiteral("ComboBox"));
+          const label_spec lspec1 = getLabelSpec(ComboBoxClass);
           QFont F(painter->font());
           if (lspec1.boldFont) F.setWeight(lspec1.boldness);
           QSize txtSize = textSize(F,combo->currentText);
@@ -4309,8 +4544,8 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         {
           if (vOffset != 0)
           { // -> drawComboLineEdit()
-            const label_spec lspec1 = getLabelSpec(QStringLiteral("LineEdit"));
-            const size_spec sspec1 = getSizeSpec(QStringLiteral("LineEdit"));
+            const label_spec lspec1 = getLabelSpec(LineEditClass);
+            const size_spec sspec1 = getSizeSpec(LineEditClass);
             if (cb->lineEdit()->height()
                 < sizeCalculated(cb->lineEdit()->font(),fspec,lspec1,sspec1,QStringLiteral("W"),QSize()).height())
             {
@@ -4323,13 +4558,13 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
             if (cb->hasFocus())
             {
               if (isWidgetInactive(widget))
-              status = "focused-inactive";
-              else status = "focused";
+              wState = FocusedState | InactiveState;
+              else wState = FocusedState;
             }
-            else if (status.startsWith("focused"))
-              status.replace("focused","normal");
-            else if (status.startsWith("toggled"))
-              status.replace("toggled","normal");
+            else if (baseState(wState) == FocusedState)
+              wState = (wState & InactiveState) | NormalState;
+            else if (baseState(wState) == ToggledState)
+              wState = (wState & InactiveState) | NormalState;
           }
         }
       }
@@ -4337,13 +4572,13 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       if (tb)
       {
         bool drawSep(false);
-        if (status.startsWith("focused")
+        if (baseState(wState) == FocusedState
             && !widget->rect().contains(widget->mapFromGlobal(QCursor::pos()))) // hover bug
         {
-          status.replace("focused","normal");
+          wState = (wState & InactiveState) | NormalState;
         }
         const QToolBar *toolBar = qobject_cast<const QToolBar*>(tb->parentWidget());
-        const frame_spec fspec1 = getFrameSpec(QStringLiteral("PanelButtonTool"));
+        const frame_spec fspec1 = getFrameSpec(PanelButtonToolClass);
         fspec.top = fspec1.top; fspec.bottom = fspec1.bottom;
         bool drawRaised = false;
         if (tspec_.group_toolbar_buttons
@@ -4390,16 +4625,16 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         }
 
         /* use the "flat" indicator with flat buttons if it exists */
-        if (status.startsWith("normal") && autoraise && !drawRaised
+        if (baseState(wState) == NormalState && autoraise && !drawRaised
             && themeRndr_ && themeRndr_->isValid())
         {
-          QString group1 = "PanelButtonTool";
-          if (group == "ToolbarButton")
+          int group1 = PanelButtonToolClass;
+          if (group == ToolbarButtonClass)
             group1 = group;
           const indicator_spec dspec1 = getIndicatorSpec(group1);
           if (flatArrowExists(dspec1.element))
           {
-            QColor col = getFromRGBA(getLabelSpec(group1).normalColor);
+            QColor col = getLabelSpec(group1).normalColor;
             if (!col.isValid())
               col = standardPalette().color(QPalette::ButtonText);
             QWidget *gp = getParent(widget,2);
@@ -4410,19 +4645,19 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
               menubar = p;
             if (menubar)
             {
-              group1 = "MenuBar";
+              group1 = MenuBarClass;
               if (mergedToolbarHeight(menubar))
-                group1 = "Toolbar";
-              if (enoughContrast(col, getFromRGBA(getLabelSpec(group1).normalColor)))
-                dspec.element = "flat-"+dspec1.element+"-down";
+                group1 = ToolbarClass;
+              if (enoughContrast(col, getLabelSpec(group1).normalColor))
+                setSpecElement(dspec, "flat-"+dspec1.element+"-down");
             }
             else if (stb)
             {
-              if (enoughContrast(col, getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
-                dspec.element = "flat-"+dspec1.element+"-down";
+              if (enoughContrast(col, getLabelSpec(ToolbarClass).normalColor))
+                setSpecElement(dspec, "flat-"+dspec1.element+"-down");
             }
             else if (p && enoughContrast(col, p->palette().color(p->foregroundRole())))
-              dspec.element = "flat-"+dspec1.element+"-down";
+              setSpecElement(dspec, "flat-"+dspec1.element+"-down");
           }
         }
       }
@@ -4433,32 +4668,32 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       {
         /* fillWidgetInterior wasn't checked for combos  */
         fillWidgetInterior = !ispec.hasInterior
-                             && hasHighContrastWithContainer(widget, getFromRGBA(getLabelSpec(cGroup).normalColor));
-        if (tspec_.square_combo_button) // the rest of the combo is like a lineedit
-          status.replace("focused","normal");
+                             && hasHighContrastWithContainer(widget, getLabelSpec(cGroup).normalColor);
+        if (tspec_.square_combo_button // the rest of the combo is like a lineedit
+            && baseState(wState) == FocusedState)
+        {
+          wState = (wState & InactiveState) | NormalState;
+        }
         if (!(option->state & State_Enabled))
         {
-          status.replace("disabled","normal");
+          wState = (wState & InactiveState) | NormalState;
           painter->save();
           painter->setOpacity(DISABLED_OPACITY);
         }
         bool mouseAnimation(animatedWidget_ == widget
-                            && (!status.startsWith("normal")
-                                || animationStartState_.startsWith("focused")));
+                            && (baseState(wState) != NormalState
+                                || baseState(animationStartState_) == FocusedState));
         bool animate(cb && cb->isEnabled()
                      && !qobject_cast<const QAbstractScrollArea*>(widget)
                      && (mouseAnimation
-                         || (animatedWidgetOut_ == widget && status.startsWith("normal"))));
-        QString animationStartState(animationStartState_);
-        if (animationStartState.startsWith("c-"))
-          animationStartState.remove(0, 2);
+                         || (animatedWidgetOut_ == widget && baseState(wState) == NormalState)));
+        int animationStartState = animationStartState_ & ~ComboState;
         int animationOpacity = animationOpacity_;
         bool animatePanel(!(tspec_.combo_focus_rect
-                            && (status.startsWith("normal")
-                                || status.startsWith("pressed"))
-                            && (animationStartState.startsWith("normal")
-                                || animationStartState.startsWith("pressed"))));
-        QString _status;
+                            && (baseState(wState) == NormalState
+                                || baseState(wState) == PressedState)
+                            && (baseState(animationStartState) == NormalState
+                                || baseState(animationStartState) == PressedState)));
         if (animate)
         {
           if (!mouseAnimation) // -> QEvent::FocusOut
@@ -4466,7 +4701,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
             animationStartState = animationStartStateOut_;
             animationOpacity = animationOpacityOut_;
           }
-          if (animationStartState == status)
+          if (animationStartState == wState)
           {
             animationOpacity = 100;
             if (!mouseAnimation)
@@ -4476,12 +4711,12 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           }
           else if (animationOpacity < 100 && animatePanel)
           {
-            _status = animationStartState;
-            if (tspec_.combo_focus_rect)
-              _status.replace("pressed", "normal");
+            int _status = animationStartState;
+            if (tspec_.combo_focus_rect && baseState(_status) == PressedState)
+              _status = (_status & InactiveState) | NormalState;
             if (!fillWidgetInterior)
-              renderInterior(painter,r,fspec,ispec,ispec.element+"-"+_status);
-            renderFrame(painter,r,fspec,fspec.element+"-"+_status);
+              renderInterior(painter,r,fspec,ispec,ispec.elementId,_status);
+            renderFrame(painter,r,fspec,fspec.elementId,_status);
           }
           if (animatePanel)
           {
@@ -4489,15 +4724,15 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
             painter->setOpacity(static_cast<qreal>(animationOpacity)/100.0);
           }
         }
-        _status = status;
-        if (tspec_.combo_focus_rect)
-          _status.replace("pressed", "normal");
+        int _state = wState;
+        if (tspec_.combo_focus_rect && baseState(_state) == PressedState)
+          _state = (_state & InactiveState) | NormalState;
         if (!fillWidgetInterior)
-          renderInterior(painter,r,fspec,ispec,ispec.element+"-"+_status);
-        renderFrame(painter,r,fspec,fspec.element+"-"+_status);
+          renderInterior(painter,r,fspec,ispec,ispec.elementId,_state);
+        renderFrame(painter,r,fspec,fspec.elementId,_state);
 
         /* draw combo separator if it exists */
-        const QString sepName = getIndicatorSpec(cGroup).element + "-separator";
+        const int sepId = suffixElementId(getIndicatorSpec(cGroup).elementId,SeparatorSuffix);
         QRect sep;
         if (rtl)
         {
@@ -4509,12 +4744,12 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         }
         else
           sep = QRect(x, y+fspec.top, fspec.left, h-fspec.top-fspec.bottom);
-        if (renderElement(painter, sepName+"-"+_status, sep))
+        if (renderElement(painter, stateElementId(sepId,_state), sep))
         {
           sep.adjust(0, -fspec.top, 0, -h+fspec.top+fspec.bottom);
-          renderElement(painter, sepName+"-top-"+_status, sep);
+          renderElement(painter, stateElementId(suffixElementId(sepId,TopSuffix),_state), sep);
           sep.adjust(0, h-fspec.bottom, 0, h-fspec.top);
-          renderElement(painter, sepName+"-bottom-"+_status, sep);
+          renderElement(painter, stateElementId(suffixElementId(sepId,BottomSuffix),_state), sep);
         }
         if (rtl)
           painter->restore();
@@ -4527,18 +4762,18 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           {
             if (animatedWidget_ == widget)
             {
-              animationStartState_ = status;
+              animationStartState_ = wState;
               // distinguish between toggled combo and toggled button
-              if (animationStartState_.startsWith("toggled"))
-                animationStartState_ = "c-" + animationStartState_;
+              if (baseState(animationStartState_) == ToggledState)
+                animationStartState_ |= ComboState;
             }
             if (!mouseAnimation)
-              animationStartStateOut_ = status;
+              animationStartStateOut_ = wState;
           }
         }
         if (fillWidgetInterior) // widget isn't null
         {
-          QColor comboCol = widget->palette().color(status.contains("-inactive")
+          QColor comboCol = widget->palette().color(isInactiveState(wState)
                                                       ? QPalette::Inactive
                                                       : QPalette::Active,
                                                     QPalette::Button);
@@ -4548,19 +4783,19 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         if (!(option->state & State_Enabled))
         {
           painter->restore();
-          status = "disabled";
+          wState = DisabledState;
           if (isWidgetInactive(widget))
-            status.append("-inactive");
+            wState |= InactiveState;
         }
       }
 
       /* distinguish between the toggled and pressed states
          only if a toggled arrow element exists */
-      if (status.startsWith("toggled")
+      if (baseState(wState) == ToggledState
           && !(themeRndr_ && themeRndr_->isValid()
                && themeRndr_->elementExists(dspec.element+"-toggled")))
       {
-        status.replace("toggled","pressed");
+        wState = (wState & InactiveState) | PressedState;
       }
       /* Konqueror may have added an icon to the right of lineedit (for LTR),
          in which case, the arrow rectangle whould be widened at CC_ComboBox */
@@ -4579,7 +4814,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       }
       renderIndicator(painter,
                       r,
-                      fspec,dspec,dspec.element+"-"+status,
+                      fspec,dspec,dspec.elementId,wState,
                       option->direction,
                       Qt::AlignCenter,
                       vOffset);
@@ -4594,7 +4829,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
     case PE_IndicatorTabTearRight :
     case PE_IndicatorTabTearLeft :
     {
-      indicator_spec dspec = getIndicatorSpec(QStringLiteral("Tab"));
+      indicator_spec dspec = getIndicatorSpec(TabClass);
       renderElement(painter,dspec.element+"-tear",option->rect);
 
       break;
@@ -4603,7 +4838,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
     case PE_IndicatorTabClose : {
       frame_spec fspec;
       default_frame_spec(fspec);
-      const indicator_spec dspec = getIndicatorSpec(QStringLiteral("Tab"));
+      const indicator_spec dspec = getIndicatorSpec(TabClass);
 
       bool pseudoState(false);
       QString status;
@@ -4652,7 +4887,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         if (!opacityTimer_->isActive())
         {
           animationOpacity_ = 0;
-          opacityTimer_->start(ANIMATION_FRAME);
+          opacityTimer_->start();
         }
         if (animationOpacity_ < 100)
         {
@@ -4744,7 +4979,7 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         /* menuitems may have their own right/left arrows */
         if (element == PE_IndicatorArrowLeft || element == PE_IndicatorArrowRight)
         {
-          const indicator_spec dspec1 = getIndicatorSpec(QStringLiteral("MenuItem"));
+          const indicator_spec dspec1 = getIndicatorSpec(MenuItemClass);
           dspec.size = dspec1.size;
           /* the arrow rectangle is set at CE_MenuItem appropriately */
           if (renderElement(painter, (/*isLibreoffice_ && aStatus.startsWith("normal") ? dspec.element :*/ dspec1.element)
@@ -4757,10 +4992,10 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         /* -> CE_MenuScroller */
         if (themeRndr_ && themeRndr_->isValid()
             && enoughContrast(standardPalette().color(QPalette::WindowText),
-                              getFromRGBA(getLabelSpec(QStringLiteral("MenuItem")).normalColor))
+                              getLabelSpec(MenuItemClass).normalColor)
             && flatArrowExists(dspec.element))
         {
-          dspec.element = "flat-"+dspec.element;
+          setSpecElement(dspec, "flat-"+dspec.element);
         }
       }
       /* only theoretically; toolbar/menubar arrows are drawn at SP_ToolBarHorizontalExtensionButton */
@@ -4771,14 +5006,14 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
             || mergedToolbarHeight(widget) > 0
             || getStylableToolbarContainer(widget)) // like k3b path arrows
         {
-          col = getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor);
+          col = getLabelSpec(ToolbarClass).normalColor;
         }
         else if (qobject_cast<const QMenuBar*>(widget))
-          col = getFromRGBA(getLabelSpec(QStringLiteral("MenuBar")).normalColor);
+          col = getLabelSpec(MenuBarClass).normalColor;
         if (enoughContrast(col, standardPalette().color(QPalette::Active,QPalette::WindowText))
             && flatArrowExists(dspec.element))
         {
-          dspec.element = "flat-"+dspec.element;
+          setSpecElement(dspec, "flat-"+dspec.element);
         }
       }
 
@@ -4836,9 +5071,10 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
          PM_FocusFrameHMargin and PM_FocusFrameVMargin for viewitems.
       */
 
-      const QString group = "ItemView";
-      frame_spec fspec = getFrameSpec(group);
-      interior_spec ispec = getInteriorSpec(group);
+      const int group = ItemViewClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      frame_spec fspec = specs.fspec;
+      interior_spec ispec = specs.ispec;
       ispec.px = ispec.py = 0;
 
       /* QCommonStyle uses something like this: */
@@ -4847,30 +5083,30 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                          (option->state & QStyle::State_Active) ? "pressed" : "toggled" :
                          (option->state & State_MouseOver) ? "focused" : "normal" : "disabled";*/
       /* but we want to know if the widget itself has focus */
-      QString ivStatus = (option->state & State_Enabled) ?
-                         // as in Okular's navigation panel
-                         ((option->state & State_Selected)
-                          && (option->state & State_HasFocus)
-                          && (option->state & State_Active)) ? "pressed" :
-                         // as in most widgets
-                         (widget && widget->hasFocus() && (option->state & State_Selected)) ? "pressed" :
-                         (option->state & State_Selected) ? "toggled" :
-                         ((option->state & State_MouseOver)
-                          /* Qt has a bug that gives a mouse-over state to a view item
-                             when the view is scrolled by holding a scrollbar and the
-                             cursor goes over the item. This is a simple workaround. */
-                          && !(QApplication::mouseButtons() & Qt::LeftButton)) ? "focused"
-                         : "normal" : "disabled";
-      if (ivStatus.startsWith("disabled") && (option->state & State_Selected))
+      int ivState = (option->state & State_Enabled) ?
+                    // as in Okular's navigation panel
+                    ((option->state & State_Selected)
+                     && (option->state & State_HasFocus)
+                     && (option->state & State_Active)) ? PressedState :
+                    // as in most widgets
+                    (widget && widget->hasFocus() && (option->state & State_Selected)) ? PressedState :
+                    (option->state & State_Selected) ? ToggledState :
+                    ((option->state & State_MouseOver)
+                     /* Qt has a bug that gives a mouse-over state to a view item
+                        when the view is scrolled by holding a scrollbar and the
+                        cursor goes over the item. This is a simple workaround. */
+                     && !(QApplication::mouseButtons() & Qt::LeftButton)) ? FocusedState
+                    : NormalState : DisabledState;
+      if (baseState(ivState) == DisabledState && (option->state & State_Selected))
       {
         /* Disabled items aren't selectable but Qt Creator wrongly disables
            the headers of a cmake project and let the user select them! */
-        ivStatus.replace("disabled","pressed");
+        ivState = (ivState & InactiveState) | PressedState;
       }
-      else if (ivStatus.startsWith("focused")
+      else if (baseState(ivState) == FocusedState
                && widget && !widget->rect().contains(widget->mapFromGlobal(QCursor::pos()))) // hover bug
       {
-        ivStatus.replace("focused","normal");
+        ivState = (ivState & InactiveState) | NormalState;
       }
       bool isInactive(isWidgetInactive(widget));
 
@@ -4987,16 +5223,16 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
              (as in Konsole's color scheme editing dialog) */
           fspec.expansion = 0;
           if (opt->state & State_HasFocus)
-            renderFrame(painter,option->rect,fspec,fspec.element+"-pressed",0,0,0,0,0,fspec.isAttached,true);
-          else if (ivStatus != "normal" && ivStatus != "disabled")
+            renderFrame(painter,option->rect,fspec,fspec.elementId,PressedState,0,0,0,0,0,fspec.isAttached,true);
+          else if (ivState != NormalState && ivState != DisabledState)
           {
             if (isWidgetInactive(widget))
-              ivStatus.append("-inactive");
-            renderFrame(painter,option->rect,fspec,fspec.element+"-"+ivStatus,0,0,0,0,0,fspec.isAttached,true);
+              ivState |= InactiveState;
+            renderFrame(painter,option->rect,fspec,fspec.elementId,ivState,0,0,0,0,0,fspec.isAttached,true);
           }
           QBrush brush = opt->backgroundBrush;
           QColor col = brush.color();
-          if ((ivStatus.startsWith("pressed") || ivStatus.startsWith("toggled"))
+          if ((baseState(ivState) == PressedState || baseState(ivState) == ToggledState)
               && !enoughContrast(col, opt->palette.color(QPalette::HighlightedText)))
           {
             /* Wireshark sets the whole color of "QStyleOptionViewItem::backgroundBrush".
@@ -5026,34 +5262,34 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
           {
             const label_spec lspec = getLabelSpec(group);
             QColor col;
-            if (ivStatus == "normal")
+            if (ivState == NormalState)
             {
               QColor tmpCol;
               if (isInactive)
               {
-                tmpCol = getFromRGBA(lspec.normalInactiveColor);
+                tmpCol = lspec.normalInactiveColor;
                 if (!tmpCol.isValid())
-                  tmpCol = getFromRGBA(lspec.normalColor);
+                  tmpCol = lspec.normalColor;
               }
               else
-                tmpCol = getFromRGBA(lspec.normalColor);
+                tmpCol = lspec.normalColor;
               QColor baseCol = opt->palette.color(QPalette::Base);
               if (baseCol.alpha() == 0)
                 baseCol = standardPalette().color(QPalette::Base);
               if (enoughContrast(baseCol, tmpCol))
                 col = tmpCol;
             }
-            else if (ivStatus == "focused")
+            else if (ivState == FocusedState)
             {
               QColor tmpCol;
               if (isInactive)
               {
-                tmpCol = getFromRGBA(lspec.focusInactiveColor);
+                tmpCol = lspec.focusInactiveColor;
                 if (!tmpCol.isValid())
-                  tmpCol = getFromRGBA(lspec.focusColor);
+                  tmpCol = lspec.focusColor;
               }
               else
-                tmpCol = getFromRGBA(lspec.focusColor);
+                tmpCol = lspec.focusColor;
               QColor baseCol = opt->palette.color(QPalette::Base);
               if (baseCol.alpha() == 0)
                 baseCol = standardPalette().color(QPalette::Base);
@@ -5064,27 +5300,27 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
                 col = tmpCol;
               }
             }
-            else if (ivStatus == "pressed")
+            else if (ivState == PressedState)
             {
               if (isInactive)
               {
-                col = getFromRGBA(lspec.pressInactiveColor);
+                col = lspec.pressInactiveColor;
                 if (!col.isValid())
-                  col = getFromRGBA(lspec.pressColor);
+                  col = lspec.pressColor;
               }
               else
-                col = getFromRGBA(lspec.pressColor);
+                col = lspec.pressColor;
             }
-            else if (ivStatus == "toggled")
+            else if (ivState == ToggledState)
             {
               if (isInactive)
               {
-                col = getFromRGBA(lspec.toggleInactiveColor);
+                col = lspec.toggleInactiveColor;
                 if (!col.isValid())
-                  col = getFromRGBA(lspec.toggleColor);
+                  col = lspec.toggleColor;
               }
               else
-                col = getFromRGBA(lspec.toggleColor);
+                col = lspec.toggleColor;
             }
             if (!col.isValid())
             {
@@ -5103,11 +5339,11 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         }
       }
 
-      if (ivStatus == "normal" || ivStatus == "disabled")
+      if (ivState == NormalState || ivState == DisabledState)
         break; // for the sake of consistency, we don't draw any background here
 
       if (isInactive)
-        ivStatus.append("-inactive");
+        ivState |= InactiveState;
 
       /* this is needed for elegance */
       if (option->rect.height() < 2)
@@ -5115,14 +5351,14 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
       else
         fspec.expansion = qMin(fspec.expansion,option->rect.height()/2);
       /* since Dolphin's view-items have problem with QSvgRenderer, we set usePixmap to true */
-      renderFrame(painter,option->rect,fspec,fspec.element+"-"+ivStatus,0,0,0,0,0,fspec.isAttached,true);
-      renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+ivStatus,fspec.isAttached,true);
+      renderFrame(painter,option->rect,fspec,fspec.elementId,ivState,0,0,0,0,0,fspec.isAttached,true);
+      renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,ivState,fspec.isAttached,true);
 
       break;
     }
 
     case PE_PanelTipLabel : {
-      const QString group = "ToolTip";
+      const int group = ToolTipClass;
 
       frame_spec fspec = getFrameSpec(group);
       fspec.expansion = 0;
@@ -5137,8 +5373,8 @@ void Style::drawPrimitive(QStyle::PrimitiveElement element,
         renderFrame(painter,option->rect,fspec,fspec.element+"-shadow");
       }
       else
-        renderFrame(painter,option->rect,fspec,fspec.element+"-normal");
-      renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-normal");
+        renderFrame(painter,option->rect,fspec,fspec.elementId,NormalState);
+      renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,NormalState);
 
       break;
     }
@@ -5157,30 +5393,30 @@ Style::KvIconMode Style::getIconMode(int state, bool isInactive, label_spec lspe
   if (state == 1 || state == 0)
   {
     if (isInactive)
-      txtCol = getFromRGBA(lspec.normalInactiveColor);
+      txtCol = lspec.normalInactiveColor;
     if (!txtCol.isValid())
-      txtCol = getFromRGBA(lspec.normalColor);
+      txtCol = lspec.normalColor;
   }
   else if (state == 2)
   {
     if (isInactive)
-      txtCol = getFromRGBA(lspec.focusInactiveColor);
+      txtCol = lspec.focusInactiveColor;
     if (!txtCol.isValid())
-      txtCol = getFromRGBA(lspec.focusColor);
+      txtCol = lspec.focusColor;
   }
   else if (state == 3)
   {
     if (isInactive)
-      txtCol = getFromRGBA(lspec.pressInactiveColor);
+      txtCol = lspec.pressInactiveColor;
     if (!txtCol.isValid())
-      txtCol = getFromRGBA(lspec.pressColor);
+      txtCol = lspec.pressColor;
   }
   else if (state == 4)
   {
     if (isInactive)
-      txtCol = getFromRGBA(lspec.toggleInactiveColor);
+      txtCol = lspec.toggleInactiveColor;
     if (!txtCol.isValid())
-      txtCol = getFromRGBA(lspec.toggleColor);
+      txtCol = lspec.toggleColor;
   }
 
   if (txtCol.isValid() // because the lack of contrast should be checked
@@ -5197,6 +5433,8 @@ void Style::drawControl(QStyle::ControlElement element,
                         QPainter *painter,
                         const QWidget *widget) const
 {
+  ProfileScope profileScope(Profiler::DrawControl,element);
+
   int x,y,h,w;
   option->rect.getRect(&x,&y,&w,&h);
 
@@ -5209,7 +5447,7 @@ void Style::drawControl(QStyle::ControlElement element,
       /* see PM_MenuTearoffHeight and also PE_PanelMenu
          (PM_MenuHMargin is already taken into account in option->rect) */
       QRect r(x, y+h-8, w, 8);
-      const indicator_spec dspec = getIndicatorSpec(QStringLiteral("MenuItem"));
+      const indicator_spec dspec = getIndicatorSpec(MenuItemClass);
       renderElement(painter,dspec.element+"-tearoff-"+status,r,20,0);
 
       break;
@@ -5220,13 +5458,14 @@ void Style::drawControl(QStyle::ControlElement element,
           qstyleoption_cast<const QStyleOptionMenuItem*>(option);
 
       if (opt) {
-        QString status = getState(option,widget);
-        const QString group = "MenuItem";
+        const int wState = getWidgetState(option,widget);
+        const int group = MenuItemClass;
 
-        const frame_spec fspec = getFrameSpec(group);
-        const interior_spec ispec = getInteriorSpec(group);
-        const indicator_spec dspec = getIndicatorSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const widget_specs &specs = getWidgetSpecs(group);
+        const frame_spec &fspec = specs.fspec;
+        const interior_spec &ispec = specs.ispec;
+        const indicator_spec &dspec = specs.dspec;
+        label_spec lspec = labelSpec(specs);
 
         bool isComboMenu(qobject_cast<const QComboBox*>(widget));
 
@@ -5242,7 +5481,7 @@ void Style::drawControl(QStyle::ControlElement element,
         else
         {
           /* don't draw panel for normal and disabled states */
-          if (!status.startsWith("normal") && (option->state & State_Enabled))
+          if (baseState(wState) != NormalState && (option->state & State_Enabled))
           {
             if (isLibreoffice_ && widget == nullptr)
             {
@@ -5251,12 +5490,12 @@ void Style::drawControl(QStyle::ControlElement element,
               painter->fillRect(option->rect, standardPalette().brush(QPalette::Highlight));
               painter->restore();
               lspec.pressColor = lspec.toggleColor
-                               = getName(standardPalette().color(QPalette::HighlightedText));
+                               = standardPalette().color(QPalette::HighlightedText);
             }
             else
             {
-              renderFrame(painter,option->rect,fspec,fspec.element+"-"+status);
-              renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+status);
+              renderFrame(painter,option->rect,fspec,fspec.elementId,wState);
+              renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,wState);
             }
           }
 
@@ -5285,16 +5524,16 @@ void Style::drawControl(QStyle::ControlElement element,
           int state = 1;
           if (!(option->state & State_Enabled))
             state = 0;
-          else if (status.startsWith("pressed"))
+          else if (baseState(wState) == PressedState)
           { // only if it exists (focus color seems more natural)
-            if (lspec.pressColor.isEmpty())
+            if (!lspec.pressColor.isValid())
               state = 2;
             else
               state = 3;
           }
-          else if (status.startsWith("toggled"))
+          else if (baseState(wState) == ToggledState)
           { // only if it exists (focus color seems more natural)
-            if (lspec.toggleColor.isEmpty())
+            if (!lspec.toggleColor.isValid())
               state = 2;
             else
               state = 4;
@@ -5304,7 +5543,7 @@ void Style::drawControl(QStyle::ControlElement element,
           if (state == 1 || state == 0)
           {
             if (widget == nullptr // QML; see PE_PanelMenu
-                || lspec.normalColor.isEmpty())
+                || !lspec.normalColor.isValid())
             {
               lspec.normalColor = cspec_.windowTextColor;
               lspec.normalInactiveColor = cspec_.inactiveWindowTextColor;
@@ -5312,7 +5551,7 @@ void Style::drawControl(QStyle::ControlElement element,
           }
           else if (state == 2)
           {
-            if (lspec.normalColor.isEmpty())
+            if (!lspec.normalColor.isValid())
             {
               lspec.focusColor = cspec_.windowTextColor;
               lspec.focusInactiveColor = cspec_.inactiveWindowTextColor;
@@ -5365,7 +5604,7 @@ void Style::drawControl(QStyle::ControlElement element,
                           Qt::AlignLeft | talign,
                           txt,QPalette::Text,
                           state,
-                          status.contains("-inactive"));
+                          isInactiveState(wState));
             }
             else
             {
@@ -5402,7 +5641,7 @@ void Style::drawControl(QStyle::ControlElement element,
               if (txt.isEmpty()) // textless menuitem, as in Kdenlive's play button menu
                 r = alignedRect(option->direction,Qt::AlignVCenter | Qt::AlignLeft,
                                 iconSize,labelRect(r,fspec,lspec));
-              bool isInactive(status.contains("-inactive"));
+              bool isInactive(isInactiveState(wState));
               renderLabel(option,painter,r,
                           fspec,lspec,
                           Qt::AlignLeft | talign,
@@ -5428,7 +5667,7 @@ void Style::drawControl(QStyle::ControlElement element,
                         Qt::AlignRight | talign,
                         l[1],QPalette::Text,
                         state,
-                        status.contains("-inactive"));
+                        isInactiveState(wState));
           }
 
           QStyleOptionMenuItem o(*opt);
@@ -5522,11 +5761,11 @@ void Style::drawControl(QStyle::ControlElement element,
           }
           if (state != 0)
           {
-            const label_spec lspec = getLabelSpec(QStringLiteral("ItemView"));
-            QColor normalColor = getFromRGBA(lspec.normalColor);
-            QColor focusColor = getFromRGBA(lspec.focusColor);
-            QColor pressColor = getFromRGBA(lspec.pressColor);
-            QColor toggleColor = getFromRGBA(lspec.toggleColor);
+            const label_spec lspec = getLabelSpec(ItemViewClass);
+            QColor normalColor = lspec.normalColor;
+            QColor focusColor = lspec.focusColor;
+            QColor pressColor = lspec.pressColor;
+            QColor toggleColor = lspec.toggleColor;
             bool isInactive;
             QColor col;
             if (opt->backgroundBrush.style() != Qt::NoBrush) //-> PE_PanelItemViewItem
@@ -5559,7 +5798,7 @@ void Style::drawControl(QStyle::ControlElement element,
               isInactive = isWidgetInactive(widget);
             if (state == 1)
             {
-              QColor normalInactiveColor = getFromRGBA(lspec.normalInactiveColor);
+              QColor normalInactiveColor = lspec.normalInactiveColor;
               QColor baseCol = palette.color(QPalette::Base);
               if (baseCol.alpha() == 0)
                 baseCol = standardPalette().color(QPalette::Base);
@@ -5599,7 +5838,7 @@ void Style::drawControl(QStyle::ControlElement element,
             }
             else if (state == 2)
             {
-              QColor focusInactiveColor = getFromRGBA(lspec.focusInactiveColor);
+              QColor focusInactiveColor = lspec.focusInactiveColor;
               QColor baseCol = palette.color(QPalette::Base);
               if (baseCol.alpha() == 0)
                 baseCol = standardPalette().color(QPalette::Base);
@@ -5655,7 +5894,7 @@ void Style::drawControl(QStyle::ControlElement element,
             }
             else if (state == 3)
             {
-              QColor pressInactiveColor = getFromRGBA(lspec.pressInactiveColor);
+              QColor pressInactiveColor = lspec.pressInactiveColor;
               col = (!isInactive || !pressInactiveColor.isValid())
                       ? pressColor
                       : pressInactiveColor;
@@ -5677,7 +5916,7 @@ void Style::drawControl(QStyle::ControlElement element,
             }
             else if (state == 4)
             {
-              QColor toggleInactiveColor = getFromRGBA(lspec.toggleInactiveColor);
+              QColor toggleInactiveColor = lspec.toggleInactiveColor;
               col = (!isInactive || !toggleInactiveColor.isValid())
                       ? toggleColor
                       : toggleInactiveColor;
@@ -5706,7 +5945,7 @@ void Style::drawControl(QStyle::ControlElement element,
             if (opacityPercentage < 100.0)
             {
               QStyleOptionViewItem o(*opt);
-              const label_spec lspec = getLabelSpec(QStringLiteral("ItemView"));
+              const label_spec lspec = getLabelSpec(ItemViewClass);
               QPixmap px = translucentPixmap(getPixmapFromIcon(opt->icon,
                                                                getIconMode(state,
                                                                            isWidgetInactive(widget),
@@ -5737,31 +5976,29 @@ void Style::drawControl(QStyle::ControlElement element,
       const QStyleOptionMenuItem *opt =
           qstyleoption_cast<const QStyleOptionMenuItem*>(option);
       if (opt) {
-        QString status = getState(option,widget);
-        if (!styleHint(SH_MenuBar_MouseTracking, opt, widget))
+        int wState = getWidgetState(option,widget);
+        if (!styleHint(SH_MenuBar_MouseTracking, opt, widget)
+            && (baseState(wState) == ToggledState || baseState(wState) == FocusedState))
         {
-          if (status.startsWith("toggled"))
-            status.replace("toggled","normal");
-          if (status.startsWith("focused"))
-            status.replace("focused","normal");
+          wState = (wState & InactiveState) | NormalState;
         }
 
-        QString group = "MenuBarItem";
+        int group = MenuBarItemClass;
         label_spec lspec = getLabelSpec(group);
 
-        group = "MenuBar";
+        group = MenuBarClass;
         QRect r = opt->menuRect; // menubar svg element may not be simple
         if (r.isEmpty()) r = option->rect;
         if (int th = mergedToolbarHeight(widget))
         {
-          group = "Toolbar";
+          group = ToolbarClass;
           r.adjust(0,0,0,th);
         }
 
         frame_spec fspec = getFrameSpec(group);
-        if (tspec_.merge_menubar_with_toolbar && group != "Toolbar")
+        if (tspec_.merge_menubar_with_toolbar && group != ToolbarClass)
         {
-          const frame_spec fspec1 = getFrameSpec(QStringLiteral("Toolbar"));
+          const frame_spec fspec1 = getFrameSpec(ToolbarClass);
           fspec.left = fspec1.left;
           fspec.top = fspec1.top;
           fspec.right = fspec1.right;
@@ -5780,14 +6017,12 @@ void Style::drawControl(QStyle::ControlElement element,
             fspec.expansion = qMin(fspec.expansion, LIMITED_EXPANSION);
           ispec.px = ispec.py = 0;
         }
-        QString inactive;
-        if (isWidgetInactive(widget))
-          inactive = "-inactive";
-        renderFrame(painter,r,fspec,fspec.element+"-normal"+inactive);
-        renderInterior(painter,r,fspec,ispec,ispec.element+"-normal"+inactive);
+        const int bgState = isWidgetInactive(widget) ? NormalState | InactiveState : NormalState;
+        renderFrame(painter,r,fspec,fspec.elementId,bgState);
+        renderInterior(painter,r,fspec,ispec,ispec.elementId,bgState);
 
-        fspec = getFrameSpec(QStringLiteral("MenuBarItem"));
-        ispec = getInteriorSpec(QStringLiteral("MenuBarItem"));
+        fspec = getFrameSpec(MenuBarItemClass);
+        ispec = getInteriorSpec(MenuBarItemClass);
 
         if (isPlasma_ && widget && widget->window()->testAttribute(Qt::WA_NoSystemBackground))
         {
@@ -5807,7 +6042,7 @@ void Style::drawControl(QStyle::ControlElement element,
         r = option->rect.adjusted(0,topFrame,0,-bottomFrame);
 
         /* draw a panel for the menubar-item only if it's focused or pressed */
-        if (!status.startsWith("normal") && (option->state & State_Enabled))
+        if (baseState(wState) != NormalState && (option->state & State_Enabled))
         {
           if (isLibreoffice_ && widget == nullptr)
           {
@@ -5817,12 +6052,12 @@ void Style::drawControl(QStyle::ControlElement element,
             painter->fillRect(option->rect, standardPalette().brush(QPalette::Highlight));
             painter->restore();
             lspec.pressColor = lspec.toggleColor
-                             = getName(standardPalette().color(QPalette::HighlightedText));
+                             = standardPalette().color(QPalette::HighlightedText);
           }
           else
           {
-            renderFrame(painter,r,fspec,fspec.element+"-"+status);
-            renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status);
+            renderFrame(painter,r,fspec,fspec.elementId,wState);
+            renderInterior(painter,r,fspec,ispec,ispec.elementId,wState);
           }
         }
         else // always get normal color from menubar (or toolbar if they're merged)
@@ -5846,24 +6081,24 @@ void Style::drawControl(QStyle::ControlElement element,
         {
           if (styleHint(SH_MenuBar_MouseTracking, opt, widget))
           {
-            if (status.startsWith("pressed"))
+            if (baseState(wState) == PressedState)
             {
-              if (lspec.pressColor.isEmpty())
+              if (!lspec.pressColor.isValid())
                 state = 2;
               else
                 state = 3;
             }
-            else if (status.startsWith("toggled"))
+            else if (baseState(wState) == ToggledState)
             {
-              if (lspec.toggleColor.isEmpty())
+              if (!lspec.toggleColor.isValid())
                 state = 2;
               else
                 state = 4;
             }
           }
-          else if (status.startsWith("pressed"))
+          else if (baseState(wState) == PressedState)
           {
-            if (lspec.pressColor.isEmpty())
+            if (!lspec.pressColor.isValid())
               state = 2;
             else
               state = 3;
@@ -5873,7 +6108,7 @@ void Style::drawControl(QStyle::ControlElement element,
                     fspec,lspec,
                     talign,opt->text,QPalette::WindowText,
                     state,
-                    status.contains("-inactive"));
+                    isInactiveState(wState));
       }
 
       break;
@@ -5881,47 +6116,46 @@ void Style::drawControl(QStyle::ControlElement element,
 
     case CE_MenuBarEmptyArea : {
       /*if (isLibreoffice_ // shouldn't be used with the Qt5 skin
-          && enoughContrast(getFromRGBA(getLabelSpec(QStringLiteral("MenuBarItem")).normalColor),
+          && enoughContrast(getLabelSpec(MenuBarItemClass).normalColor,
                             QApplication::palette().color(QPalette::WindowText)))
       {
         break;
       }*/
-      QString group = "MenuBar";
+      int group = MenuBarClass;
       QRect r = option->rect;
       if (int th = mergedToolbarHeight(widget))
       {
-        group = "Toolbar";
+        group = ToolbarClass;
         r.adjust(0,0,0,th);
       }
 
-      frame_spec fspec = getFrameSpec(group);
-      interior_spec ispec = getInteriorSpec(group);
+      const widget_specs &specs = getWidgetSpecs(group);
+      frame_spec fspec = specs.fspec;
+      interior_spec ispec = specs.ispec;
       if (!widget) // WARNING: QML has anchoring!
       {
         fspec.expansion = 0;
         ispec.px = ispec.py = 0;
       }
-      if (tspec_.merge_menubar_with_toolbar && group != "Toolbar")
+      if (tspec_.merge_menubar_with_toolbar && group != ToolbarClass)
       {
-        const frame_spec fspec1 = getFrameSpec(QStringLiteral("Toolbar"));
+        const frame_spec fspec1 = getFrameSpec(ToolbarClass);
         fspec.left = fspec1.left;
         fspec.top = fspec1.top;
         fspec.right = fspec1.right;
         fspec.bottom = fspec1.bottom;
       }
 
-      QString inactive;
-      if (isWidgetInactive(widget))
-        inactive = "-inactive";
-      renderFrame(painter,r,fspec,fspec.element+"-normal"+inactive);
-      renderInterior(painter,r,fspec,ispec,ispec.element+"-normal"+inactive);
+      const int bgState = isWidgetInactive(widget) ? NormalState | InactiveState : NormalState;
+      renderFrame(painter,r,fspec,fspec.elementId,bgState);
+      renderInterior(painter,r,fspec,ispec,ispec.elementId,bgState);
 
       break;
     }
 
     case CE_MenuScroller : {
       /*if (enoughContrast(standardPalette().color(QPalette::WindowText),
-          getFromRGBA(getLabelSpec(QStringLiteral("MenuItem")).normalColor)))
+          getLabelSpec(MenuItemClass).normalColor))
       {
         painter->fillRect(option->rect, standardPalette().brush(QPalette::Window));
       }*/
@@ -5943,16 +6177,16 @@ void Style::drawControl(QStyle::ControlElement element,
 
         if (opt->state & State_HasFocus)
         {
-          QString group;
+          int group;
           QRect fRect;
           if (isRadio)
           {
-            group = "RadioButton";
+            group = RadioButtonClass;
             fRect = subElementRect(SE_RadioButtonFocusRect, opt, widget);
           }
           else
           {
-            group = "CheckBox";
+            group = CheckBoxClass;
             fRect = subElementRect(SE_CheckBoxFocusRect, opt, widget);
           }
           const frame_spec fspec = getFrameSpec(group);
@@ -5991,7 +6225,7 @@ void Style::drawControl(QStyle::ControlElement element,
       if (opt) {
         frame_spec fspec;
         default_frame_spec(fspec);
-        label_spec lspec = getLabelSpec(QStringLiteral("RadioButton"));
+        label_spec lspec = getLabelSpec(RadioButtonClass);
         /* vertically centered */
         lspec.top = qMin(lspec.top,2);
         lspec.bottom = qMin(lspec.bottom,2);
@@ -6001,9 +6235,9 @@ void Style::drawControl(QStyle::ControlElement element,
              of menus to the normal menuitem text color because some
              apps (like QtAv) might do weird things with menus */
           lspec.normalColor = lspec.focusColor
-          = getName(widget->palette().color(QPalette::Active,QPalette::WindowText));
+          = widget->palette().color(QPalette::Active,QPalette::WindowText);
           lspec.normalInactiveColor = lspec.focusInactiveColor
-          = getName(widget->palette().color(QPalette::Inactive,QPalette::WindowText));
+          = widget->palette().color(QPalette::Inactive,QPalette::WindowText);
         }
 
         int talign = Qt::AlignLeft | Qt::AlignVCenter;
@@ -6037,16 +6271,16 @@ void Style::drawControl(QStyle::ControlElement element,
       if (opt) {
         frame_spec fspec;
         default_frame_spec(fspec);
-        label_spec lspec = getLabelSpec(QStringLiteral("CheckBox"));
+        label_spec lspec = getLabelSpec(CheckBoxClass);
         /* vertically centered */
         lspec.top = qMin(lspec.top,2);
         lspec.bottom = qMin(lspec.bottom,2);
         if (widget && qobject_cast<QMenu*>(widget->window()))
         { // see the explanation at CE_RadioButtonLabel (above)
           lspec.normalColor = lspec.focusColor
-          = getName(widget->palette().color(QPalette::Active,QPalette::WindowText));
+          = widget->palette().color(QPalette::Active,QPalette::WindowText);
           lspec.normalInactiveColor = lspec.focusInactiveColor
-          = getName(widget->palette().color(QPalette::Inactive,QPalette::WindowText));
+          = widget->palette().color(QPalette::Inactive,QPalette::WindowText);
         }
 
         int talign = Qt::AlignLeft | Qt::AlignVCenter;
@@ -6091,18 +6325,19 @@ void Style::drawControl(QStyle::ControlElement element,
         if (isWidgetInactive(widget))
           status.append("-inactive");
 
-        QString group;
-        if ((!getFrameSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty()
-             || !getInteriorSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty())
+        int group;
+        if ((!getFrameSpec(ToolbarComboBoxClass).element.isEmpty()
+             || !getInteriorSpec(ToolbarComboBoxClass).element.isEmpty())
             && getStylableToolbarContainer(widget, true))
         {
-          group = "ToolbarComboBox";
+          group = ToolbarComboBoxClass;
         }
-        else group = "ComboBox";
+        else group = ComboBoxClass;
 
-        frame_spec fspec = getFrameSpec(group);
-        label_spec lspec = getLabelSpec(group);
-        size_spec sspec = getSizeSpec(group);
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        label_spec lspec = labelSpec(specs);
+        size_spec sspec = specs.sspec;
 
         /* there's no reason for a variable distance from the arrow
             because the combobox length doesn't change with it */
@@ -6127,11 +6362,11 @@ void Style::drawControl(QStyle::ControlElement element,
         int state = 1;
         if (!(option->state & State_Enabled))
           state = 0;
-        else if (status.startsWith("pressed"))
+        else if (status.startsWith(QLatin1String("pressed")))
           state = 3;
-        else if (status.startsWith("toggled"))
+        else if (status.startsWith(QLatin1String("toggled")))
           state = 4;
-        else if (status.startsWith("focused"))
+        else if (status.startsWith(QLatin1String("focused")))
           state = 2;
 
         /* when there isn't enough space */
@@ -6176,9 +6411,9 @@ void Style::drawControl(QStyle::ControlElement element,
             lspec.tispace += sspec.minW/2;
         }
         QStyleOptionComboBox o(*opt);
-        if ((option->state & State_MouseOver) && !status.startsWith("focused"))
+        if ((option->state & State_MouseOver) && !status.startsWith(QLatin1String("focused")))
           o.state = o.state & ~QStyle::State_MouseOver; // hover bug
-        bool isInactive(status.contains("-inactive"));
+        bool isInactive(status.contains(QLatin1String("-inactive")));
         renderLabel(&o,painter,r,
                     fspec,lspec,
                     talign,opt->currentText,QPalette::ButtonText,
@@ -6197,22 +6432,22 @@ void Style::drawControl(QStyle::ControlElement element,
 
       if (opt)
       {
-        frame_spec fspec = getFrameSpec(QStringLiteral("Tab"));
-        interior_spec ispec = getInteriorSpec(QStringLiteral("Tab"));
+        frame_spec fspec = getFrameSpec(TabClass);
+        interior_spec ispec = getInteriorSpec(TabClass);
 
         /* Let's forget about the pressed state. It's useless here and
            makes trouble in KDevelop. The disabled state is useless too. */
-        QString status =
-                (option->state & State_On) ? "toggled" :
-                 (option->state & State_Selected) ? "toggled" :
+        int wState =
+                (option->state & State_On) ? ToggledState :
+                 (option->state & State_Selected) ? ToggledState :
                  (option->state & State_MouseOver) ?
-                  (option->state & State_Enabled) ? "focused" : "normal"
-                : "normal";
+                  (option->state & State_Enabled) ? FocusedState : NormalState
+                : NormalState;
         int frameExpansion = fspec.expansion;
-        if (status != "toggled" && tspec_.no_inactive_tab_expansion)
+        if (wState != ToggledState && tspec_.no_inactive_tab_expansion)
           fspec.expansion = 0;
         if (isWidgetInactive(widget))
-          status.append("-inactive");
+          wState |= InactiveState;
 
         QRect r = option->rect;
         bool verticalTabs = false;
@@ -6238,10 +6473,13 @@ void Style::drawControl(QStyle::ControlElement element,
 
         if (docMode && hasFloatingTabs_)
         {
-          ispec.element="floating-"+ispec.element;
-          fspec.element="floating-"+fspec.element;
+          setSpecElement(ispec, "floating-"+ispec.element);
+          setSpecElement(fspec, "floating-"+fspec.element);
           if (!fspec.expandedElement.isEmpty())
+          {
             fspec.expandedElement="floating-"+fspec.expandedElement;
+            fspec.expandedElementId = elementId(fspec.expandedElement);
+          }
           joinedActiveTab = joinedActiveFloatingTab_;
           sepName = "floating-"+sepName;
         }
@@ -6265,7 +6503,7 @@ void Style::drawControl(QStyle::ControlElement element,
           sepName += "-inactive";
 
         if ((joinedActiveTab && !noActiveTabSep)
-            || status.startsWith("normal") || status.startsWith("focused"))
+            || baseState(wState) == NormalState || baseState(wState) == FocusedState)
         {
           if (tspec_.joined_inactive_tabs
               && opt->position != QStyleOptionTab::OnlyOneTab)
@@ -6495,7 +6733,7 @@ void Style::drawControl(QStyle::ControlElement element,
         if (overlap > 0 && (!joinedActiveTab || noActiveTabSep)
             && opt->position != QStyleOptionTab::OnlyOneTab)
         {
-          if (!status.startsWith("toggled"))
+          if (baseState(wState) != ToggledState)
           {
             int exp = qMin(frameExpansion, qMin(r.width(), r.height())) / 2 + 1;
             overlap = qMin(overlap, qMax(exp, qMax(fspec.left, fspec.right)));
@@ -6556,13 +6794,13 @@ void Style::drawControl(QStyle::ControlElement element,
               else
                 R.adjust(0,0,-r.width()/2,0);
             }
-            renderInterior(painter,R,fspec1,ispec,ispec.element+"-normal",true);
-            renderFrame(painter,R,fspec1,fspec1.element+"-normal",0,0,0,0,0,true);
+            renderInterior(painter,R,fspec1,ispec,ispec.elementId,NormalState,true);
+            renderFrame(painter,R,fspec1,fspec1.elementId,NormalState,0,0,0,0,0,true);
           }
         }
 
-        renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status,true);
-        renderFrame(painter,r,fspec,fspec.element+"-"+status,0,0,0,0,0,true);
+        renderInterior(painter,r,fspec,ispec,ispec.elementId,wState,true);
+        renderFrame(painter,r,fspec,fspec.elementId,wState,0,0,0,0,0,true);
         if ((opt->state & State_HasFocus)
             && fspec.hasFocusFrame) // otherwise -> CE_TabBarTabLabel
         {
@@ -6588,7 +6826,7 @@ void Style::drawControl(QStyle::ControlElement element,
            rectangle won't be updated automatically. (A Qt design flaw?) */
         if (!docMode && tspec_.attach_active_tab)
         { // tw exists
-          fspec = getFrameSpec(QStringLiteral("TabFrame"));
+          fspec = getFrameSpec(TabFrameClass);
           if (verticalTabs)
           {
             if (opt->shape == QTabBar::RoundedWest || opt->shape == QTabBar::TriangularWest)
@@ -6621,9 +6859,10 @@ void Style::drawControl(QStyle::ControlElement element,
               (option->state & State_MouseOver) ? 2 : 1
             : 0;
 
-        const QString group = "Tab";
-        frame_spec fspec = getFrameSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const int group = TabClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        label_spec lspec = labelSpec(specs);
 
         if (state == 4 && tspec_.bold_active_tab)
           lspec.boldFont = true;
@@ -6951,23 +7190,23 @@ void Style::drawControl(QStyle::ControlElement element,
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.normalInactiveColor);
+              col = lspec.normalInactiveColor;
               if (!col.isValid())
-                col = getFromRGBA(lspec.normalColor);
+                col = lspec.normalColor;
             }
             else
-              col = getFromRGBA(lspec.normalColor);
+              col = lspec.normalColor;
           }
           else if (state == 2)
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.focusInactiveColor);
+              col = lspec.focusInactiveColor;
               if (!col.isValid())
-                col = getFromRGBA(lspec.focusColor);
+                col = lspec.focusColor;
             }
             else
-              col = getFromRGBA(lspec.focusColor);
+              col = lspec.focusColor;
             qreal tintPercentage = static_cast<qreal>(hspec_.tint_on_mouseover);
             if (tintPercentage > 0 && !opt->icon.isNull())
               px = tintedPixmap(option, px,tintPercentage);
@@ -6976,12 +7215,12 @@ void Style::drawControl(QStyle::ControlElement element,
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.pressInactiveColor);
+              col = lspec.pressInactiveColor;
               if (!col.isValid())
-                col = getFromRGBA(lspec.pressColor);
+                col = lspec.pressColor;
             }
             else
-              col = getFromRGBA(lspec.pressColor);
+              col = lspec.pressColor;
             qreal tintPercentage = static_cast<qreal>(hspec_.tint_on_mouseover);
             if (tintPercentage > 0 && (option->state & State_MouseOver) && !opt->icon.isNull())
               px = tintedPixmap(option, px,tintPercentage);
@@ -7098,10 +7337,10 @@ void Style::drawControl(QStyle::ControlElement element,
     case CE_ProgressBarGroove : {
       const QStyleOptionProgressBar *opt =
           qstyleoption_cast<const QStyleOptionProgressBar*>(option);
-      QString group;
+      int group;
       if (tspec_.vertical_spin_indicators && isKisSlider_)
-        group = "LineEdit";
-      else group = "Progressbar";
+        group = LineEditClass;
+      else group = ProgressbarClass;
 
       frame_spec fspec = getFrameSpec(group);
       fspec.left = fspec.right = qMin(fspec.left,fspec.right);
@@ -7124,8 +7363,8 @@ void Style::drawControl(QStyle::ControlElement element,
         else if (fspec.expansion != 0)
         {
           fspec.expansion = qMin(tspec_.inline_spin_indicators
-                                   ? getFrameSpec(QStringLiteral("LineEdit")).expansion
-                                   : getFrameSpec(QStringLiteral("IndicatorSpinBox")).expansion,
+                                   ? getFrameSpec(LineEditClass).expansion
+                                   : getFrameSpec(IndicatorSpinBoxClass).expansion,
                                  fspec.expansion);
         }
       }
@@ -7149,7 +7388,7 @@ void Style::drawControl(QStyle::ControlElement element,
         inverted = !inverted;
 
       QFont f(painter->font());
-      const label_spec lspec = getLabelSpec(QStringLiteral("Progressbar"));
+      const label_spec lspec = getLabelSpec(ProgressbarClass);
       if (lspec.boldFont) f.setWeight(lspec.boldness);
 
       /* This is the condition set at CT_ProgressBar for using thin progressbars.
@@ -7276,13 +7515,13 @@ void Style::drawControl(QStyle::ControlElement element,
 
       if (opt)
       {
-        QString status =
+        int wState =
                  (option->state & State_Enabled) ?
                    //(option->state & State_Selected) ? "toggled" :
-                   (option->state & State_MouseOver) ? "focused" : "normal"
-                 : "disabled";
+                   (option->state & State_MouseOver) ? FocusedState : NormalState
+                 : DisabledState;
         if (isWidgetInactive(widget))
-          status.append("-inactive");
+          wState |= InactiveState;
 
         bool isVertical = false;
         bool inverted = false;
@@ -7298,7 +7537,7 @@ void Style::drawControl(QStyle::ControlElement element,
         if (!isVertical && option->direction == Qt::RightToLeft)
           inverted = !inverted;
 
-        frame_spec fspecPr = getFrameSpec(QStringLiteral("Progressbar"));
+        frame_spec fspecPr = getFrameSpec(ProgressbarClass);
         if (isKisSlider_)
           fspecPr.right = 0;
         else
@@ -7321,7 +7560,7 @@ void Style::drawControl(QStyle::ControlElement element,
         }
 
         QFont f(painter->font());
-        const label_spec lspec = getLabelSpec(QStringLiteral("Progressbar"));
+        const label_spec lspec = getLabelSpec(ProgressbarClass);
         if (lspec.boldFont) f.setWeight(lspec.boldness);
 
         if (!isKisSlider_ && tspec_.progressbar_thickness > 0
@@ -7455,7 +7694,7 @@ void Style::drawControl(QStyle::ControlElement element,
           w = r.width();
         }
 
-        const QString group = "ProgressbarContents";
+        const int group = ProgressbarContentsClass;
         frame_spec fspec = getFrameSpec(group);
         if (isKisSlider_)
         {
@@ -7487,8 +7726,8 @@ void Style::drawControl(QStyle::ControlElement element,
           fspec.expansion = (isKisSlider_
                                ? qMin(fspecPr.expansion,
                                       tspec_.inline_spin_indicators
-                                        ? getFrameSpec(QStringLiteral("LineEdit")).expansion
-                                        : getFrameSpec(QStringLiteral("IndicatorSpinBox")).expansion)
+                                        ? getFrameSpec(LineEditClass).expansion
+                                        : getFrameSpec(IndicatorSpinBoxClass).expansion)
                                : fspecPr.expansion)
                             - (spreadProgressbar ? 0 : fspecPr.top+fspecPr.bottom);
           if (fspec.expansion >= qMin(h,w)) isRounded = true;
@@ -7577,8 +7816,8 @@ void Style::drawControl(QStyle::ControlElement element,
           {
             fspec.top = fspec.bottom = r.height()/2;
           }
-          renderFrame(painter,r,fspec,fspec.element+"-"+status,0,0,0,0,0,true);
-          renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status,true);
+          renderFrame(painter,r,fspec,fspec.elementId,wState,0,0,0,0,0,true);
+          renderInterior(painter,r,fspec,ispec,ispec.elementId,wState,true);
           if (thin)
             painter->restore();
         }
@@ -7606,6 +7845,15 @@ void Style::drawControl(QStyle::ControlElement element,
           int W = !isRounded ? pm : !isVertical ? qMax(h,pm) : qMax(w,pm);
           if (W <= 0 || W > r.width()) return;
           R.setWidth(W);
+          /* remember the indicator geometry for repainting only its place */
+          if (painter->device() == widget)
+          {
+            busy_indicator &indicator = busyIndicators_[widget];
+            indicator.transform = painter->transform();
+            indicator.track = r;
+            indicator.width = W;
+            indicator.inverted = inverted;
+          }
           if (R.height() >= 0 && R.height() < fspec.top+fspec.bottom)
           {
             fspec.top = fspec.bottom = r.height()/2;
@@ -7642,8 +7890,8 @@ void Style::drawControl(QStyle::ControlElement element,
               }
             }
 
-            renderFrame(painter,R1,fspec,fspec.element+"-"+status,0,0,0,0,0,true);
-            renderInterior(painter,R1,fspec,ispec,ispec.element+"-"+status,true);
+            renderFrame(painter,R1,fspec,fspec.elementId,wState,0,0,0,0,0,true);
+            renderInterior(painter,R1,fspec,ispec,ispec.elementId,wState,true);
             if (thin)
               painter->restore();
 
@@ -7674,15 +7922,15 @@ void Style::drawControl(QStyle::ControlElement element,
               }
             }
 
-            renderFrame(painter,R,fspec,fspec.element+"-"+status,0,0,0,0,0,true);
-            renderInterior(painter,R,fspec,ispec,ispec.element+"-"+status,true);
+            renderFrame(painter,R,fspec,fspec.elementId,wState,0,0,0,0,0,true);
+            renderInterior(painter,R,fspec,ispec,ispec.elementId,wState,true);
             if (thin)
               painter->restore();
           }
           else
           {
-            renderFrame(painter,R,fspec,fspec.element+"-"+status,0,0,0,0,0,true);
-            renderInterior(painter,R,fspec,ispec,ispec.element+"-"+status,true);
+            renderFrame(painter,R,fspec,fspec.elementId,wState,0,0,0,0,0,true);
+            renderInterior(painter,R,fspec,ispec,ispec.elementId,wState,true);
           }
         }
         else
@@ -7703,10 +7951,10 @@ void Style::drawControl(QStyle::ControlElement element,
 
         frame_spec fspec;
         default_frame_spec(fspec);
-        label_spec lspec = getLabelSpec(QStringLiteral("Progressbar"));
+        label_spec lspec = getLabelSpec(ProgressbarClass);
         lspec.left = lspec.right = lspec.top = lspec.bottom = 0;
 
-        frame_spec fspecPr = getFrameSpec(QStringLiteral("Progressbar"));
+        frame_spec fspecPr = getFrameSpec(ProgressbarClass);
         if (isKisSlider_)
           fspecPr.right = 0;
         else
@@ -7738,21 +7986,21 @@ void Style::drawControl(QStyle::ControlElement element,
           sideText = !topText;
           if (topText || sideText)
           {
-            if (enoughContrast(getFromRGBA(lspec.normalColor),
+            if (enoughContrast(lspec.normalColor,
                                standardPalette().color(QPalette::WindowText)))
             {
               lspec.normalColor = lspec.focusColor =
-                getName(standardPalette().color(QPalette::Active,QPalette::WindowText));
+                standardPalette().color(QPalette::Active,QPalette::WindowText);
               lspec.normalInactiveColor = lspec.focusInactiveColor =
-                getName(standardPalette().color(QPalette::Inactive,QPalette::WindowText));
+                standardPalette().color(QPalette::Inactive,QPalette::WindowText);
             }
-            if (enoughContrast(getFromRGBA(lspec.toggleColor),
+            if (enoughContrast(lspec.toggleColor,
                                standardPalette().color(QPalette::HighlightedText)))
             {
               lspec.toggleColor =
-                getName(standardPalette().color(QPalette::Active,QPalette::HighlightedText));
+                standardPalette().color(QPalette::Active,QPalette::HighlightedText);
               lspec.toggleInactiveColor =
-                getName(standardPalette().color(QPalette::Inactive,QPalette::HighlightedText));
+                standardPalette().color(QPalette::Inactive,QPalette::HighlightedText);
             }
           }
         }
@@ -7834,10 +8082,10 @@ void Style::drawControl(QStyle::ControlElement element,
         }
         if (state == 4)
         {
-          lspec.toggleColor = getName(standardPalette().color(isInactive
-                                                                ? QPalette::Inactive
-                                                                : QPalette::Active,
-                                                              QPalette::HighlightedText));
+          lspec.toggleColor = standardPalette().color(isInactive
+                                                        ? QPalette::Inactive
+                                                        : QPalette::Active,
+                                                      QPalette::HighlightedText);
         }
 
         QRect R; // the indicator part
@@ -7848,13 +8096,13 @@ void Style::drawControl(QStyle::ControlElement element,
           r.setRect(r.left()+fspecPr.left, r.top(), length, r.height());
 
           /* find the part inside the indicator */
-          QColor col = getFromRGBA(cspec_.progressIndicatorTextColor);
+          QColor col = cspec_.progressIndicatorTextColor;
           if (col.isValid() && state != 0)
           {
             QColor txtCol;
-            if (state == 1) txtCol = getFromRGBA(lspec.normalColor);
-            else if (state == 2) txtCol = getFromRGBA(lspec.focusColor);
-            else if (state == 4) txtCol = getFromRGBA(lspec.toggleColor);
+            if (state == 1) txtCol = lspec.normalColor;
+            else if (state == 2) txtCol = lspec.focusColor;
+            else if (state == 4) txtCol = lspec.toggleColor;
             /* do nothing if the colors are the same */
             if ((!txtCol.isValid() || col != txtCol)
                 && (txtCol.isValid() || col != standardPalette().color(QPalette::WindowText)))
@@ -7978,17 +8226,18 @@ void Style::drawControl(QStyle::ControlElement element,
     }
 
     case CE_Splitter : {
-      const QString group = "Splitter";
-      const frame_spec fspec = getFrameSpec(group);
-      const interior_spec ispec = getInteriorSpec(group);
-      const indicator_spec dspec = getIndicatorSpec(group);
-      QString status =
+      const int group = SplitterClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      const frame_spec &fspec = specs.fspec;
+      const interior_spec &ispec = specs.ispec;
+      const indicator_spec &dspec = specs.dspec;
+      int wState =
           (option->state & State_Enabled) ?
-            (option->state & State_Sunken) ? "pressed" :
-            (option->state & State_MouseOver) ? "focused" : "normal"
-          : "disabled";
+            (option->state & State_Sunken) ? PressedState :
+            (option->state & State_MouseOver) ? FocusedState : NormalState
+          : DisabledState;
       if (isWidgetInactive(widget))
-        status.append("-inactive");
+        wState |= InactiveState;
 
       QRect r = option->rect;
       /* we don't check State_Horizontal because it may
@@ -8007,17 +8256,17 @@ void Style::drawControl(QStyle::ControlElement element,
 
       if (!(option->state & State_Enabled))
       {
-        status.replace("disabled","normal");
+        wState = (wState & InactiveState) | NormalState;
         painter->save();
         painter->setOpacity(DISABLED_OPACITY);
       }
-      renderFrame(painter,r,fspec,fspec.element+"-"+status);
-      renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status);
+      renderFrame(painter,r,fspec,fspec.elementId,wState);
+      renderInterior(painter,r,fspec,ispec,ispec.elementId,wState);
       /* some UIs set the handle width */
       int iW = pixelMetric(PM_SplitterWidth)-fspec.left-fspec.right;
       if (iW > qMin(w,h)) iW = qMin(w,h);
       renderElement(painter,
-                    dspec.element+"-"+status,
+                    stateElementId(dspec.elementId,wState),
                     alignedRect(option->direction,
                                 Qt::AlignCenter,
                                 QSize(iW, qMin(dspec.size, qMax(w,h))),
@@ -8063,7 +8312,7 @@ void Style::drawControl(QStyle::ControlElement element,
             iStatus = "normal";
 
           if (isWidgetInactive(widget)
-              && !iStatus.endsWith("-inactive"))
+              && !iStatus.endsWith(QLatin1String("-inactive")))
           {
             iStatus.append("-inactive");
           }
@@ -8099,37 +8348,38 @@ void Style::drawControl(QStyle::ControlElement element,
 
     case CE_ScrollBarSlider : {
       /* no toggled state (especially good with transient scrollbars) */
-      QString status = (option->state & State_Enabled) ?
-                       (option->state & State_Sunken) ? "pressed" :
-                       (option->state & State_Selected) ? "pressed" :
-                       (option->state & State_MouseOver) ? "focused" : "normal"
-                       : "disabled";
+      int wState = (option->state & State_Enabled) ?
+                   (option->state & State_Sunken) ? PressedState :
+                   (option->state & State_Selected) ? PressedState :
+                   (option->state & State_MouseOver) ? FocusedState : NormalState
+                   : DisabledState;
       if (isWidgetInactive(widget))
-        status.append("-inactive");
-      if (status.startsWith("focused")
+        wState |= InactiveState;
+      if (baseState(wState) == FocusedState
           && widget && !widget->rect().contains(widget->mapFromGlobal(QCursor::pos()))) // hover bug
       {
-        status.replace("focused","normal");
+        wState = (wState & InactiveState) | NormalState;
       }
-      QString sStatus = status; // slider state
+      int sState = wState; // slider state
       if (!tspec_.animate_states // focus on entering the groove only with animation
           && (option->state & State_Enabled))
       {
         const QStyleOptionSlider *opt = qstyleoption_cast<const QStyleOptionSlider*>(option);
         if (opt && opt->activeSubControls != QStyle::SC_ScrollBarSlider)
         {
-          sStatus = "normal";
+          sState = NormalState;
           if (isWidgetInactive(widget))
-            sStatus = "normal-inactive";
+            sState = NormalState | InactiveState;
         }
       }
 
-      const QString group = "ScrollbarSlider";
+      const int group = ScrollbarSliderClass;
 
       frame_spec fspec = getFrameSpec(group);
       fspec.expansion = 0; // no need to frame expansion because the thickness is known
-      interior_spec ispec = getInteriorSpec(group);
-      const indicator_spec dspec = getIndicatorSpec(group);
+      const widget_specs &specs = getWidgetSpecs(group);
+      interior_spec ispec = specs.ispec;
+      const indicator_spec &dspec = specs.dspec;
 
       QRect r = option->rect;
       if (option->state & State_Horizontal)
@@ -8178,13 +8428,15 @@ void Style::drawControl(QStyle::ControlElement element,
           fspec.hasFrame = fspec1.hasFrame;
           ispec.hasInterior = ispec1.hasInterior;
           fspec.element = fspec1.element;
+          fspec.elementId = fspec1.elementId;
           ispec.element = ispec1.element;
+          ispec.elementId = ispec1.elementId;
         }
       }
 
       if (!(option->state & State_Enabled))
       {
-        sStatus.replace("disabled","normal");
+        sState = (sState & InactiveState) | NormalState;
         painter->save();
         painter->setOpacity(DISABLED_OPACITY);
       }
@@ -8193,23 +8445,23 @@ void Style::drawControl(QStyle::ControlElement element,
       if (animate)
       {
         qreal opacity = painter->opacity();
-        if (animationStartState_ == sStatus)
+        if (animationStartState_ == sState)
           animationOpacity_ = 100;
         else if (animationOpacity_ < 100)
         {
-          renderFrame(painter,r,fspec,fspec.element+"-"+animationStartState_);
-          renderInterior(painter,r,fspec,ispec,ispec.element+"-"+animationStartState_);
+          renderFrame(painter,r,fspec,fspec.elementId,animationStartState_);
+          renderInterior(painter,r,fspec,ispec,ispec.elementId,animationStartState_);
         }
         painter->save();
         painter->setOpacity(qMin(static_cast<qreal>(animationOpacity_)/100.0, opacity));
       }
-      renderFrame(painter,r,fspec,fspec.element+"-"+sStatus);
-      renderInterior(painter,r,fspec,ispec,ispec.element+"-"+sStatus);
+      renderFrame(painter,r,fspec,fspec.elementId,sState);
+      renderInterior(painter,r,fspec,ispec,ispec.elementId,sState);
       if (animate)
       {
         painter->restore();
         if (animationOpacity_ >= 100)
-          animationStartState_ = sStatus;
+          animationStartState_ = sState;
       }
       QSize indicatorSize(r.width() - fspec.left-fspec.right,
                           qMin(dspec.size, r.height() - fspec.top-fspec.bottom));
@@ -8219,7 +8471,7 @@ void Style::drawControl(QStyle::ControlElement element,
         indicatorSize = QSize(squareW,squareW);
       }
       renderElement(painter,
-                    dspec.element+"-"+status, // let the grip change on mouse-over for the whole scrollbar
+                    stateElementId(dspec.elementId,wState), // let the grip change on mouse-over for the whole scrollbar
                     alignedRect(option->direction,
                                 Qt::AlignCenter,
                                 indicatorSize,
@@ -8247,9 +8499,10 @@ void Style::drawControl(QStyle::ControlElement element,
                   position is always from left to right, so that, for example,
                   "QStyleOptionHeader::Beginning" is the leftmost section with RTL
                   too. This isn't logical but simplifies the calculation a lot. */
-      const QString group = "HeaderSection";
-      frame_spec fspec = getFrameSpec(group);
-      const interior_spec ispec = getInteriorSpec(group);
+      const int group = HeaderSectionClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      frame_spec fspec = specs.fspec;
+      const interior_spec &ispec = specs.ispec;
       bool rtl(option->direction == Qt::RightToLeft);
       bool stretched(false);
       if (const QHeaderView *hv = qobject_cast<const QHeaderView*>(widget))
@@ -8333,10 +8586,10 @@ void Style::drawControl(QStyle::ControlElement element,
         painter->setTransform(m, true);
       }
 
-      QString status = getState(option,widget);
+      int wState = getWidgetState(option,widget);
       if (!(option->state & State_Enabled))
       {
-        status.replace("disabled","normal");
+        wState = (wState & InactiveState) | NormalState;
         painter->save();
         painter->setOpacity(DISABLED_OPACITY);
       }
@@ -8354,11 +8607,11 @@ void Style::drawControl(QStyle::ControlElement element,
           painter->fillRect(r, option->palette.brush(iv->viewport()->backgroundRole()));
       }
 
-      renderFrame(painter,r,fspec,fspec.element+"-"+status,0,0,0,0,0,true);
-      renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status,true);
+      renderFrame(painter,r,fspec,fspec.elementId,wState,0,0,0,0,0,true);
+      renderInterior(painter,r,fspec,ispec,ispec.elementId,wState,true);
       /* if there's no header separator, use the right frame */
       if (themeRndr_ && themeRndr_->isValid() && !elementExists(QStringLiteral("header-separator")))
-        renderElement(painter, fspec.element + "-" + status + "-right", sep);
+        renderElement(painter, suffixElementId(stateElementId(fspec.elementId,wState),RightSuffix), sep);
       else
         renderElement(painter,QStringLiteral("header-separator"),sep);
       if (!(option->state & State_Enabled))
@@ -8374,10 +8627,11 @@ void Style::drawControl(QStyle::ControlElement element,
         qstyleoption_cast<const QStyleOptionHeader*>(option);
 
       if (opt) {
-        const QString group = "HeaderSection";
+        const int group = HeaderSectionClass;
 
-        frame_spec fspec = getFrameSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        label_spec lspec = labelSpec(specs);
 
         bool rtl(opt->direction == Qt::RightToLeft);
 
@@ -8449,19 +8703,19 @@ void Style::drawControl(QStyle::ControlElement element,
           }
         }
 
-        QString status = getState(option,widget);
+        const int wState = getWidgetState(option,widget);
         int state = 1;
         if (!(option->state & State_Enabled))
           state = 0;
-        else if (status.startsWith("pressed"))
+        else if (baseState(wState) == PressedState)
           state = 3;
-        else if (status.startsWith("toggled"))
+        else if (baseState(wState) == ToggledState)
           state = 4;
-        else if (status.startsWith("focused"))
+        else if (baseState(wState) == FocusedState)
           state = 2;
 
         QSize iconSize = QSize(smallIconSize,smallIconSize);
-        bool isInactive(status.contains("-inactive"));
+        bool isInactive(isInactiveState(wState));
         renderLabel(option,painter,
                     option->rect.adjusted(rtl ?
                                             opt->sortIndicator != QStyleOptionHeader::None ?
@@ -8525,7 +8779,7 @@ void Style::drawControl(QStyle::ControlElement element,
           }
         }
       }
-      const QString group = "Toolbar";
+      const int group = ToolbarClass;
       if (!stylable)
       {
         if (widget && option->styleObject)
@@ -8538,13 +8792,13 @@ void Style::drawControl(QStyle::ControlElement element,
 #if (QT_VERSION >= QT_VERSION_CHECK(5,12,0))
             QColor pTxtCol = standardPalette().color(QPalette::PlaceholderText);
 #endif
-            QColor toolbarTxtCol(getFromRGBA(getLabelSpec(group).normalColor));
+            QColor toolbarTxtCol(getLabelSpec(group).normalColor);
 
             if (enoughContrast(txtCol, toolbarTxtCol))
             {
               opacifyColor(toolbarTxtCol);
-              bool toolbarComboBox(!getFrameSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty()
-                                   || !getInteriorSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty());
+              bool toolbarComboBox(!getFrameSpec(ToolbarComboBoxClass).element.isEmpty()
+                                   || !getInteriorSpec(ToolbarComboBoxClass).element.isEmpty());
               QColor inactiveTxtCol = standardPalette().color(QPalette::Inactive, QPalette::Text);
               QColor disabledTxtCol = standardPalette().color(QPalette::Disabled, QPalette::Text);
 
@@ -8577,7 +8831,7 @@ void Style::drawControl(QStyle::ControlElement element,
 
               if (toolbarComboBox)
               {
-                QColor comboTxtCol = getFromRGBA(getLabelSpec(QStringLiteral("ComboBox")).normalColor);
+                QColor comboTxtCol = getLabelSpec(ComboBoxClass).normalColor;
                 if (comboTxtCol.isValid())
                 {
                   QColor comboDisabledTxtCol = comboTxtCol;
@@ -8602,8 +8856,8 @@ void Style::drawControl(QStyle::ControlElement element,
                 }
               }
 
-              if (!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-                  || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+              if (!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+                  || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
               {
                 const QList<QLineEdit*> lineEdits = widget->findChildren<QLineEdit*>();
                 for (QLineEdit *le : lineEdits)
@@ -8662,8 +8916,9 @@ void Style::drawControl(QStyle::ControlElement element,
         painter->setTransform(m, true);
       }
 
-      frame_spec fspec = getFrameSpec(group);
-      interior_spec ispec = getInteriorSpec(group);
+      const widget_specs &specs = getWidgetSpecs(group);
+      frame_spec fspec = specs.fspec;
+      interior_spec ispec = specs.ispec;
       if (hPos != 2)
       {
         fspec.isAttached = true;
@@ -8681,11 +8936,11 @@ void Style::drawControl(QStyle::ControlElement element,
             || toolbarState == "unstyled") // the toolbar wasn't styled before
         {
           const label_spec tlspec = getLabelSpec(group);
-          QColor txtCol = getFromRGBA(tlspec.normalColor);
+          QColor txtCol = tlspec.normalColor;
 
           if (txtCol.isValid())
           {
-            QColor inactiveTxtCol = getFromRGBA(tlspec.normalInactiveColor);
+            QColor inactiveTxtCol = tlspec.normalInactiveColor;
             if (!inactiveTxtCol.isValid()) inactiveTxtCol = txtCol;
             QColor disabledTxtCol = txtCol;
             disabledTxtCol.setAlpha(102); // 0.4 * disabledTxtCol.alpha()
@@ -8702,8 +8957,8 @@ void Style::drawControl(QStyle::ControlElement element,
             if (enoughContrast(standardPalette().color(QPalette::Active,QPalette::Text), txtCol))
             {
               opacifyColor(txtCol); // after determining the contrast
-              bool toolbarComboBox(!getFrameSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty()
-                                   || !getInteriorSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty());
+              bool toolbarComboBox(!getFrameSpec(ToolbarComboBoxClass).element.isEmpty()
+                                   || !getInteriorSpec(ToolbarComboBoxClass).element.isEmpty());
 
               const QList<QWidget*> children = widget->findChildren<QWidget*>(QString(), Qt::FindDirectChildrenOnly);
               for (QWidget *child : children)
@@ -8744,7 +8999,7 @@ void Style::drawControl(QStyle::ControlElement element,
 
               if (toolbarComboBox)
               {
-                QColor comboTxtCol = getFromRGBA(getLabelSpec(QStringLiteral("ToolbarComboBox")).normalColor);
+                QColor comboTxtCol = getLabelSpec(ToolbarComboBoxClass).normalColor;
                 if (comboTxtCol.isValid())
                 {
                   QColor comboDisabledTxtCol = comboTxtCol;
@@ -8769,8 +9024,8 @@ void Style::drawControl(QStyle::ControlElement element,
                 }
               }
 
-              if (!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-                  || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+              if (!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+                  || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
               {
                 const QList<QLineEdit*> lineEdits = widget->findChildren<QLineEdit*>();
                 for (QLineEdit *le : lineEdits)
@@ -8909,10 +9164,11 @@ void Style::drawControl(QStyle::ControlElement element,
           qstyleoption_cast<const QStyleOptionButton*>(option);
 
       if (opt) {
-        const QString group = "PanelButtonCommand";
-        frame_spec fspec = getFrameSpec(group);
-        const indicator_spec dspec = getIndicatorSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const int group = PanelButtonCommandClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        const indicator_spec &dspec = specs.dspec;
+        label_spec lspec = labelSpec(specs);
         QWidget *p = qobject_cast<QTabWidget*>(getParent(widget,1));
         if (isPlasma_ && widget && widget->window()->testAttribute(Qt::WA_NoSystemBackground))
         {
@@ -8991,8 +9247,8 @@ void Style::drawControl(QStyle::ControlElement element,
                                         0,
                                         -(opt->direction == Qt::RightToLeft ? 0 : ind),
                                         0);
-        QString status = getState(option,widget);
-        if (status.startsWith("toggled") || status.startsWith("pressed"))
+        const int wState = getWidgetState(option,widget);
+        if (baseState(wState) == ToggledState || baseState(wState) == PressedState)
         {
           int hShift = pixelMetric(PM_ButtonShiftHorizontal);
           int vShift = pixelMetric(PM_ButtonShiftVertical);
@@ -9007,9 +9263,9 @@ void Style::drawControl(QStyle::ControlElement element,
         int state = 1;
         if (!(option->state & State_Enabled))
           state = 0;
-        else if (status.startsWith("pressed"))
+        else if (baseState(wState) == PressedState)
           state = 3;
-        else if (status.startsWith("toggled"))
+        else if (baseState(wState) == ToggledState)
           state = 4;
         else if ((option->state & State_MouseOver)
                  && (!widget || widget->rect().contains(widget->mapFromGlobal(QCursor::pos())))) // hover bug
@@ -9017,8 +9273,8 @@ void Style::drawControl(QStyle::ControlElement element,
 
         if (opt->features & QStyleOptionButton::Flat) // respect the text color of the parent widget
         {
-          lspec.normalColor = getName(standardPalette().color(QPalette::Active,QPalette::WindowText));
-          lspec.normalInactiveColor = getName(standardPalette().color(QPalette::Inactive,QPalette::WindowText));
+          lspec.normalColor = standardPalette().color(QPalette::Active,QPalette::WindowText);
+          lspec.normalInactiveColor = standardPalette().color(QPalette::Inactive,QPalette::WindowText);
         }
 
         QStyleOptionButton o(*opt);
@@ -9036,7 +9292,7 @@ void Style::drawControl(QStyle::ControlElement element,
             R.adjust(margin, 0, -margin, 0);
         }
 
-        bool isInactive(status.contains("-inactive"));
+        bool isInactive(isInactiveState(wState));
         renderLabel(&o,painter,
                     R,
                     fspec,lspec,
@@ -9065,69 +9321,70 @@ void Style::drawControl(QStyle::ControlElement element,
           qstyleoption_cast<const QStyleOptionButton*>(option);
 
       if (opt) {
-        QString status = getState(option,widget);
-        if (status.startsWith("focused")
+        int wState = getWidgetState(option,widget);
+        if (baseState(wState) == FocusedState
             && widget && !widget->rect().contains(widget->mapFromGlobal(QCursor::pos()))) // hover bug
         {
-          status.replace("focused","normal");
+          wState = (wState & InactiveState) | NormalState;
         }
-        const QString group = "PanelButtonCommand";
-        frame_spec fspec = getFrameSpec(group);
-        const interior_spec ispec = getInteriorSpec(group);
-        indicator_spec dspec = getIndicatorSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const int group = PanelButtonCommandClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        const interior_spec &ispec = specs.ispec;
+        indicator_spec dspec = specs.dspec;
+        label_spec lspec = labelSpec(specs);
 
         /* force text color if the button isn't drawn in a standard way */
         if (widget && !standardButton.contains(widget)
             && (option->state & State_Enabled))
         {
-          bool isInactive(status.contains("-inactive"));
+          bool isInactive(isInactiveState(wState));
           QColor col;
-          if (!(opt->features & QStyleOptionButton::Flat) || !status.startsWith("normal"))
+          if (!(opt->features & QStyleOptionButton::Flat) || !baseState(wState) == NormalState)
           {
-            if (status.startsWith("pressed"))
+            if (baseState(wState) == PressedState)
             {
               if (isInactive)
               {
-                col = getFromRGBA(lspec.pressInactiveColor);
+                col = lspec.pressInactiveColor;
                 if (!col.isValid())
-                  col = getFromRGBA(lspec.pressColor);
+                  col = lspec.pressColor;
               }
               else
-                col = getFromRGBA(lspec.pressColor);
+                col = lspec.pressColor;
             }
-            else if (status.startsWith("toggled"))
+            else if (baseState(wState) == ToggledState)
             {
               if (isInactive)
               {
-                col = getFromRGBA(lspec.toggleInactiveColor);
+                col = lspec.toggleInactiveColor;
                 if (!col.isValid())
-                  col = getFromRGBA(lspec.toggleColor);
+                  col = lspec.toggleColor;
               }
               else
-                col = getFromRGBA(lspec.toggleColor);
+                col = lspec.toggleColor;
             }
             else if (option->state & State_MouseOver)
             {
               if (isInactive)
               {
-                col = getFromRGBA(lspec.focusInactiveColor);
+                col = lspec.focusInactiveColor;
                 if (!col.isValid())
-                  col = getFromRGBA(lspec.focusColor);
+                  col = lspec.focusColor;
               }
               else
-                col = getFromRGBA(lspec.focusColor);
+                col = lspec.focusColor;
             }
             else
             {
               if (isInactive)
               {
-                col = getFromRGBA(lspec.normalInactiveColor);
+                col = lspec.normalInactiveColor;
                 if (!col.isValid())
-                  col = getFromRGBA(lspec.normalColor);
+                  col = lspec.normalColor;
               }
               else
-                col = getFromRGBA(lspec.normalColor);
+                col = lspec.normalColor;
             }
 
             if (!col.isValid())
@@ -9254,11 +9511,9 @@ void Style::drawControl(QStyle::ControlElement element,
         }
         if (!(option->state & State_Enabled))
         {
-          status = "normal";
-          if (option->state & State_On)
-            status = "toggled";
+          wState = (option->state & State_On) ? ToggledState : NormalState;
           if (isWidgetInactive(widget))
-            status.append("-inactive");
+            wState |= InactiveState;
           painter->save();
           painter->setOpacity(DISABLED_OPACITY);
         }
@@ -9272,16 +9527,16 @@ void Style::drawControl(QStyle::ControlElement element,
                     && widget->palette().color(QPalette::Button) != standardPalette().color(QPalette::Button))))
         { // color button!?
           fspec.expansion = 0;
-          renderFrame(painter,option->rect,fspec,fspec.element+"-"+status);
+          renderFrame(painter,option->rect,fspec,fspec.elementId,wState);
           painter->fillRect(interiorRect(opt->rect,fspec), widget->palette().brush(QPalette::Button));
         }
         else
         {
           bool fillWidgetInterior(!ispec.hasInterior
-                                  && hasHighContrastWithContainer(widget, getFromRGBA(getLabelSpec(group).normalColor)));
+                                  && hasHighContrastWithContainer(widget, getLabelSpec(group).normalColor));
           bool libreoffice = false;
           if (isLibreoffice_ && widget == nullptr && (option->state & State_Enabled)
-              && enoughContrast(getFromRGBA(lspec.normalColor), standardPalette().color(QPalette::ButtonText)))
+              && enoughContrast(lspec.normalColor, standardPalette().color(QPalette::ButtonText)))
           {
             libreoffice = true;
             painter->fillRect(option->rect, standardPalette().brush(QPalette::Window));
@@ -9289,35 +9544,32 @@ void Style::drawControl(QStyle::ControlElement element,
             painter->setOpacity(0.5);
           }
           QObject *styleObject = option->styleObject;
-          QString animationStartState;
-          if (styleObject)
-            animationStartState = styleObject->property("_kv_state").toString();
+          const int animationStartState = animationStartStateOf(styleObject);
           bool animate(widget && widget->isEnabled() && animatedWidget_ == widget
-                       && !animationStartState.isEmpty()
+                       && animationStartState != NoState
                        && !qobject_cast<const QAbstractScrollArea*>(widget));
-          if (animate && animationStartState == status)
+          if (animate && animationStartState == wState)
           {
             if (opacityTimer_->isActive())
               opacityTimer_->stop();
             animationOpacity_ = 0;
             animate = false;
           }
-          if (!(opt->features & QStyleOptionButton::Flat) || !status.startsWith("normal"))
+          if (!(opt->features & QStyleOptionButton::Flat) || !baseState(wState) == NormalState)
           {
             if (animate)
             {
               if (!opacityTimer_->isActive())
               {
                 animationOpacity_ = 0;
-                opacityTimer_->start(ANIMATION_FRAME);
+                opacityTimer_->start();
               }
               if (animationOpacity_ < 100
                   && (!(opt->features & QStyleOptionButton::Flat)
-                      || !animationStartState.startsWith("normal")))
+                      || baseState(animationStartState) != NormalState))
               {
-                renderFrame(painter,option->rect,fspec,fspec.element+"-"+animationStartState);
-                if (!fillWidgetInterior)
-                  renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+animationStartState);
+                renderAnimatedPanel(painter,widget,option->rect,fspec,ispec,animationStartState,
+                                    !fillWidgetInterior);
               }
               painter->save();
               painter->setOpacity(static_cast<qreal>(animationOpacity_)/100.0);
@@ -9341,79 +9593,78 @@ void Style::drawControl(QStyle::ControlElement element,
                                   option->palette.brush(QPalette::Active, QPalette::Button));
               }
               else
-                renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+status);
+                renderInterior(painter,option->rect,fspec,ispec,ispec.elementId,wState);
             }
-            renderFrame(painter,option->rect,fspec,fspec.element+"-"+status);
+            renderFrame(painter,option->rect,fspec,fspec.elementId,wState);
             if (animate)
             {
               painter->restore();
               if (animationOpacity_ >= 100)
-                styleObject->setProperty("_kv_state", status);
+                styleObject->setProperty("_kv_state", wState);
             }
             else if (styleObject)
-              styleObject->setProperty("_kv_state", status);
+              styleObject->setProperty("_kv_state", wState);
             if (fillWidgetInterior) // widget isn't null
-              painter->fillRect(interiorRect(option->rect,fspec), widget->palette().brush(status.contains("-inactive")
+              painter->fillRect(interiorRect(option->rect,fspec), widget->palette().brush(isInactiveState(wState)
                                                                                             ? QPalette::Inactive
                                                                                             : QPalette::Active,
                                                                                           QPalette::Button));
           }
           // fade out animation
-          else if (animate && !animationStartState.startsWith("normal"))
+          else if (animate && baseState(animationStartState) != NormalState)
           {
             if (!opacityTimer_->isActive())
             {
               animationOpacity_ = 0;
-              opacityTimer_->start(ANIMATION_FRAME);
+              opacityTimer_->start();
             }
             if (animationOpacity_ < 100)
             {
               painter->save();
               painter->setOpacity(1.0 - static_cast<qreal>(animationOpacity_)/100.0);
-              renderFrame(painter,option->rect,fspec,fspec.element+"-"+animationStartState);
-              if (!fillWidgetInterior)
-                renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-"+animationStartState);
+              renderAnimatedPanel(painter,widget,option->rect,fspec,ispec,animationStartState,
+                                  !fillWidgetInterior);
               painter->restore();
               if (fillWidgetInterior)
-                painter->fillRect(interiorRect(option->rect,fspec), widget->palette().brush(status.contains("-inactive")
+                painter->fillRect(interiorRect(option->rect,fspec), widget->palette().brush(isInactiveState(wState)
                                                                                               ? QPalette::Inactive
                                                                                               : QPalette::Active,
                                                                                             QPalette::Button));
             }
             if (animationOpacity_ >= 100)
-              styleObject->setProperty("_kv_state", status);
+              styleObject->setProperty("_kv_state", wState);
           }
           else if (styleObject)
-            styleObject->setProperty("_kv_state", status);
+            styleObject->setProperty("_kv_state", wState);
           if (libreoffice) painter->restore();
         }
         if (!(option->state & State_Enabled))
         {
           painter->restore();
-          status = "disabled";
+          wState = DisabledState;
         }
 
         if (opt->features & QStyleOptionButton::HasMenu)
         {
           QString aStatus = "normal";
           /* use the "flat" indicator with flat buttons if it exists */
-          if ((opt->features & QStyleOptionButton::Flat) && status.startsWith("normal"))
+          if ((opt->features & QStyleOptionButton::Flat) && baseState(wState) == NormalState)
           {
             if (themeRndr_ && themeRndr_->isValid())
             {
-              QColor ncol = getFromRGBA(lspec.normalColor);
+              QColor ncol = lspec.normalColor;
               if (!ncol.isValid())
                 ncol = standardPalette().color(QPalette::ButtonText);
               if (enoughContrast(ncol, standardPalette().color(QPalette::WindowText))
                   && flatArrowExists(dspec.element))
-                dspec.element = "flat-"+dspec.element;
+                setSpecElement(dspec, "flat-"+dspec.element);
             }
           }
           else
           {
             if (!(option->state & State_Enabled))
               aStatus = "disabled";
-            else if (status.startsWith("toggled") || status.startsWith("pressed"))
+            else if (baseState(wState) == ToggledState || baseState(wState) == PressedState)
               aStatus = "pressed";
             else if ((option->state & State_MouseOver)
                      && (!widget || widget->rect().contains(widget->mapFromGlobal(QCursor::pos())))) // hover bug
@@ -9435,7 +9686,7 @@ void Style::drawControl(QStyle::ControlElement element,
         if (pb && pb->isDefault() && (option->state & State_Enabled))
         {
           QString di = "button-default-indicator";
-          if (!((opt->features & QStyleOptionButton::Flat) && status.startsWith("normal")))
+          if (!((opt->features & QStyleOptionButton::Flat) && baseState(wState) == NormalState))
           {
             renderFrame(painter,option->rect,fspec,fspec.element+"-default");
             renderInterior(painter,option->rect,fspec,ispec,ispec.element+"-default");
@@ -9488,7 +9739,7 @@ void Style::drawControl(QStyle::ControlElement element,
         const QToolButton *tb = qobject_cast<const QToolButton*>(widget);
         QString txt = opt->text;
         QString status = getState(option,widget);
-        QString group = "PanelButtonTool";
+        int group = PanelButtonToolClass;
         QWidget *p = getParent(widget,1);
         QWidget *gp = getParent(p,1);
         QWidget *stb = nullptr;
@@ -9501,10 +9752,10 @@ void Style::drawControl(QStyle::ControlElement element,
           if (stb)
           {
             autoraise = true;
-            if (!getFrameSpec(QStringLiteral("ToolbarButton")).element.isEmpty()
-                || !getInteriorSpec(QStringLiteral("ToolbarButton")).element.isEmpty())
+            if (!getFrameSpec(ToolbarButtonClass).element.isEmpty()
+                || !getInteriorSpec(ToolbarButtonClass).element.isEmpty())
             {
-              group = "ToolbarButton";
+              group = ToolbarButtonClass;
             }
           }
 
@@ -9522,9 +9773,10 @@ void Style::drawControl(QStyle::ControlElement element,
             drawRaised = true;
         }
 
-        frame_spec fspec = getFrameSpec(group);
-        indicator_spec dspec = getIndicatorSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        indicator_spec dspec = specs.dspec;
+        label_spec lspec = labelSpec(specs);
         /*bool inPlasma = false;
         QWidget *p = getParent(widget,1);
         if (isPlasma_ && widget
@@ -9555,7 +9807,7 @@ void Style::drawControl(QStyle::ControlElement element,
 
         const Qt::ToolButtonStyle tialign = opt->toolButtonStyle;
 
-        if (status.startsWith("focused"))
+        if (status.startsWith(QLatin1String("focused")))
         {
           if (widget)
           {
@@ -9563,7 +9815,7 @@ void Style::drawControl(QStyle::ControlElement element,
             if (fspec.expansion > 0 || (tb && tb->popupMode() != QToolButton::MenuButtonPopup))
               R = widget->rect();
             if (!R.contains(widget->mapFromGlobal(QCursor::pos()))) // hover bug
-              status.replace("focused","normal");
+              status.replace(QLatin1String("focused"),QLatin1String("normal"));
           }
         }
 
@@ -9575,7 +9827,7 @@ void Style::drawControl(QStyle::ControlElement element,
               && tb->isDown() && tb->toolButtonStyle() == Qt::ToolButtonTextBesideIcon
               && qobject_cast<QMenu*>(p))
           {
-            status.replace("pressed","toggled");
+            status.replace(QLatin1String("pressed"),QLatin1String("toggled"));
           }
 
           /* the right arrow is attached */
@@ -9594,9 +9846,9 @@ void Style::drawControl(QStyle::ControlElement element,
           bool noPanel(!paneledButtons.contains(widget));
           if ((autoraise && !drawRaised) /*|| inPlasma*/ || noPanel)
           {
-            bool isNormal(status.startsWith("normal")
+            bool isNormal(status.startsWith(QLatin1String("normal"))
                           /* cover the simple disabled state too */
-                          || (status.startsWith("disabled")
+                          || (status.startsWith(QLatin1String("disabled"))
                               && !(option->state & State_On)
                               && !(option->state & State_Sunken)
                               && !(option->state & State_Selected)));
@@ -9605,17 +9857,17 @@ void Style::drawControl(QStyle::ControlElement element,
             QColor ncol;
             if (noPanel && (option->state & State_Enabled))
             {
-              if (status.startsWith("normal"))
-                ncol = getFromRGBA(lspec.normalColor);
-              else if (status.startsWith("focused"))
-                ncol = getFromRGBA(lspec.focusColor);
-              else if (status.startsWith("pressed"))
-                ncol = getFromRGBA(lspec.pressColor);
+              if (status.startsWith(QLatin1String("normal")))
+                ncol = lspec.normalColor;
+              else if (status.startsWith(QLatin1String("focused")))
+                ncol = lspec.focusColor;
+              else if (status.startsWith(QLatin1String("pressed")))
+                ncol = lspec.pressColor;
               else// if (status.startsWith("toggled"))
-                ncol = getFromRGBA(lspec.toggleColor);
+                ncol = lspec.toggleColor;
             }
             else // auto-raise
-              ncol = getFromRGBA(lspec.normalColor);
+              ncol = lspec.normalColor;
             if (!ncol.isValid())
               ncol = standardPalette().color(QPalette::ButtonText);
 
@@ -9628,15 +9880,15 @@ void Style::drawControl(QStyle::ControlElement element,
             {
               if (isNormal || noPanel)
               {
-                QString group1("MenuBar");
+                int group1 = MenuBarClass;
                 if (mergedToolbarHeight(menubar))
-                  group1 = "Toolbar";
+                  group1 = ToolbarClass;
                 const label_spec lspec1 = getLabelSpec(group1);
                 if (themeRndr_ && themeRndr_->isValid()
-                    && enoughContrast(ncol, getFromRGBA(lspec1.normalColor))
+                    && enoughContrast(ncol, lspec1.normalColor)
                     && flatArrowExists(dspec.element))
                 {
-                  dspec.element = "flat-"+dspec.element;
+                  setSpecElement(dspec, "flat-"+dspec.element);
                 }
                 if (isNormal)
                 {
@@ -9649,12 +9901,12 @@ void Style::drawControl(QStyle::ControlElement element,
             {
               if (isNormal || noPanel)
               {
-                const label_spec lspec1 = getLabelSpec(QStringLiteral("Toolbar"));
+                const label_spec lspec1 = getLabelSpec(ToolbarClass);
                 if (themeRndr_ && themeRndr_->isValid()
-                    && enoughContrast(ncol, getFromRGBA(lspec1.normalColor))
+                    && enoughContrast(ncol, lspec1.normalColor)
                     && flatArrowExists(dspec.element))
                 {
-                  dspec.element = "flat-"+dspec.element;
+                  setSpecElement(dspec, "flat-"+dspec.element);
                 }
                 if (isNormal)
                 {
@@ -9667,17 +9919,17 @@ void Style::drawControl(QStyle::ControlElement element,
             {
               QColor col;
               if (!(autoraise && !drawRaised) && noPanel) // an already styled toolbutton
-                col = opt->palette.color(status.contains("-inactive")
+                col = opt->palette.color(status.contains(QLatin1String("-inactive"))
                                            ? QPalette::Inactive
                                            : QPalette::Active,
                                          QPalette::ButtonText); // p->palette()?
               else
-                col = p->palette().color(status.contains("-inactive")
+                col = p->palette().color(status.contains(QLatin1String("-inactive"))
                                            ? QPalette::Inactive
                                            : QPalette::Active,
                                          p->foregroundRole());
               if (!col.isValid())
-                col = standardPalette().color(status.contains("-inactive")
+                col = standardPalette().color(status.contains(QLatin1String("-inactive"))
                                                ? QPalette::Inactive
                                                : QPalette::Active,
                                               QPalette::WindowText);
@@ -9687,26 +9939,26 @@ void Style::drawControl(QStyle::ControlElement element,
                     && enoughContrast(ncol, col)
                     && flatArrowExists(dspec.element))
                 {
-                  dspec.element = "flat-"+dspec.element;
+                  setSpecElement(dspec, "flat-"+dspec.element);
                 }
                 if (isNormal)
                 {
-                  lspec.normalColor = lspec.normalInactiveColor = getName(col);
+                  lspec.normalColor = lspec.normalInactiveColor = col;
                 }
 
                 if (/*inPlasma ||*/ noPanel)
                 {
-                  lspec.focusColor = lspec.focusInactiveColor = getName(col);
-                  lspec.toggleColor = lspec.toggleInactiveColor = getName(col);
+                  lspec.focusColor = lspec.focusInactiveColor = col;
+                  lspec.toggleColor = lspec.toggleInactiveColor = col;
                   /* take care of Plasma menu titles */
                   if (!qobject_cast<QMenu*>(p))
                   {
-                    lspec.pressColor = lspec.pressInactiveColor = getName(col);
+                    lspec.pressColor = lspec.pressInactiveColor = col;
                   }
                   else if (transMenuTitle)
                   {
-                    lspec.pressColor = getLabelSpec(QStringLiteral("MenuItem")).normalColor;
-                    lspec.pressInactiveColor = getLabelSpec(QStringLiteral("MenuItem")).normalInactiveColor;
+                    lspec.pressColor = getLabelSpec(MenuItemClass).normalColor;
+                    lspec.pressInactiveColor = getLabelSpec(MenuItemClass).normalInactiveColor;
                   }
                 }
               }
@@ -9715,8 +9967,8 @@ void Style::drawControl(QStyle::ControlElement element,
           /* KDE menu titles */
           else if (qobject_cast<QMenu*>(p) && transMenuTitle)
           {
-            lspec.pressColor = getLabelSpec(QStringLiteral("MenuItem")).normalColor;
-            lspec.pressInactiveColor = getLabelSpec(QStringLiteral("MenuItem")).normalInactiveColor;
+            lspec.pressColor = getLabelSpec(MenuItemClass).normalColor;
+            lspec.pressInactiveColor = getLabelSpec(MenuItemClass).normalInactiveColor;
           }
 
           /* when there isn't enough space (as in Qupzilla's bookmark toolbar) */
@@ -9836,7 +10088,7 @@ void Style::drawControl(QStyle::ControlElement element,
             }
             else
             {
-              const frame_spec fspec1 = getFrameSpec(QStringLiteral("DropDownButton"));
+              const frame_spec fspec1 = getFrameSpec(DropDownButtonClass);
               if (tb->width() < opt->iconSize.width()+fspec.left
                                 +(opt->direction == Qt::RightToLeft ? fspec1.left : fspec1.right)
                                 +TOOL_BUTTON_ARROW_SIZE+2*TOOL_BUTTON_ARROW_MARGIN)
@@ -9852,8 +10104,8 @@ void Style::drawControl(QStyle::ControlElement element,
           lspec.boldFont = false;
           lspec.left = lspec.right = lspec.top = lspec.bottom = lspec.tispace = 0;
           fspec.left = fspec.right = fspec.top = fspec.bottom = 0;
-          lspec.normalColor = getName(opt->palette.color(QPalette::Active,QPalette::ButtonText));
-          lspec.normalInactiveColor = getName(opt->palette.color(QPalette::Inactive,QPalette::ButtonText));
+          lspec.normalColor = opt->palette.color(QPalette::Active,QPalette::ButtonText);
+          lspec.normalInactiveColor = opt->palette.color(QPalette::Inactive,QPalette::ButtonText);
         }
 
         /* Unlike in CE_PushButtonLabel, option->rect includes the whole
@@ -9884,7 +10136,7 @@ void Style::drawControl(QStyle::ControlElement element,
           if (qobject_cast<QTabBar*>(p)) // tabbar scroll button
           {
             dspec.size = qMax(dspec.size, pixelMetric(PM_TabCloseIndicatorWidth));
-            const frame_spec fspec1 = getFrameSpec(QStringLiteral("Tab"));
+            const frame_spec fspec1 = getFrameSpec(TabClass);
             qreal rDiff = 0;
             if (lspec.top+fspec.top + lspec.bottom+fspec.bottom > 0)
             {
@@ -9973,16 +10225,16 @@ void Style::drawControl(QStyle::ControlElement element,
           int state = 1;
           if (!(option->state & State_Enabled))
             state = 0;
-          else if (status.startsWith("pressed"))
+          else if (status.startsWith(QLatin1String("pressed")))
             state = 3;
-          else if (status.startsWith("toggled"))
+          else if (status.startsWith(QLatin1String("toggled")))
             state = 4;
-          else if (status.startsWith("focused"))
+          else if (status.startsWith(QLatin1String("focused")))
             state = 2;
           QStyleOptionToolButton o(*opt);
           if ((option->state & State_MouseOver) && state != 2)
             o.state = o.state & ~QStyle::State_MouseOver; // hover bug
-          bool isInactive(status.contains("-inactive"));
+          bool isInactive(status.contains(QLatin1String("-inactive")));
           QSize iconSize = opt->iconSize;
           if (widget && widget->inherits("QDockWidgetTitleButton"))
           {
@@ -10020,13 +10272,13 @@ void Style::drawControl(QStyle::ControlElement element,
           break;
         }
 
-        if (status.startsWith("toggled")
+        if (status.startsWith(QLatin1String("toggled"))
             && (!themeRndr_ || !themeRndr_->isValid()
                 || !themeRndr_->elementExists(dspec.element+"-down-toggled")))
         {
           /* distinguish between the toggled and pressed states
              only if a toggled down arrow element exists */
-          status.replace("toggled","pressed");
+          status.replace(QLatin1String("toggled"),QLatin1String("pressed"));
         }
         if (!txt.isEmpty()) // it's empty for QStackedWidget
           r.adjust(lspec.left,lspec.top,-lspec.right,-lspec.bottom);
@@ -10068,11 +10320,12 @@ void Style::drawControl(QStyle::ControlElement element,
           qstyleoption_cast<const QStyleOptionDockWidget*>(option);
 
       if (opt) {
-        const QString group = "DockTitle";
+        const int group = DockTitleClass;
 
-        frame_spec fspec = getFrameSpec(group);
-        interior_spec ispec = getInteriorSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        interior_spec ispec = specs.ispec;
+        label_spec lspec = labelSpec(specs);
         fspec.expansion = 0;
 
         QRect r = option->rect;
@@ -10094,15 +10347,15 @@ void Style::drawControl(QStyle::ControlElement element,
           painter->setTransform(m, true);
         }
 
-        QString status = getState(option,widget);
+        int wState = getWidgetState(option,widget);
         if (!(option->state & State_Enabled))
         {
-          status.replace("disabled","normal");
+          wState = (wState & InactiveState) | NormalState;
           painter->save();
           painter->setOpacity(DISABLED_OPACITY);
         }
-        renderFrame(painter,r,fspec,fspec.element+"-"+status);
-        renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status);
+        renderFrame(painter,r,fspec,fspec.elementId,wState);
+        renderInterior(painter,r,fspec,ispec,ispec.elementId,wState);
         if (!(option->state & State_Enabled))
           painter->restore();
 
@@ -10140,7 +10393,7 @@ void Style::drawControl(QStyle::ControlElement element,
                     fspec,lspec,
                     talign,title,QPalette::WindowText,
                     option->state & State_Enabled ? option->state & State_MouseOver ? 2 : 1 : 0,
-                    status.contains("-inactive"));
+                    isInactiveState(wState));
 
         if (hasVertTitle)
         {
@@ -10224,6 +10477,8 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                                QPainter *painter,
                                const QWidget *widget) const
 {
+  ProfileScope profileScope(Profiler::DrawComplexControl,control);
+
   int x,y,h,w;
   option->rect.getRect(&x,&y,&w,&h);
 
@@ -10240,7 +10495,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
           standardButton.insert(widget);
           connect(widget, &QObject::destroyed, this, &Style::removeFromSet, Qt::UniqueConnection);
         }
-        QString group = "PanelButtonTool";
+        int group = PanelButtonToolClass;
         bool autoraise(false);
         QWidget *stb = getStylableToolbarContainer(widget);
         if (tb)
@@ -10249,15 +10504,16 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
           if (stb)
           {
             autoraise = true;
-            if (!getFrameSpec(QStringLiteral("ToolbarButton")).element.isEmpty()
-                || !getInteriorSpec(QStringLiteral("ToolbarButton")).element.isEmpty())
+            if (!getFrameSpec(ToolbarButtonClass).element.isEmpty()
+                || !getInteriorSpec(ToolbarButtonClass).element.isEmpty())
             {
-              group = "ToolbarButton";
+              group = ToolbarButtonClass;
             }
           }
         }
-        frame_spec fspec = getFrameSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        label_spec lspec = labelSpec(specs);
         QStyleOptionToolButton o(*opt);
 
         QRect r = subControlRect(CC_ToolButton,opt,SC_ToolButton,widget);
@@ -10315,19 +10571,19 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
             lspec = getLabelSpec(group);
 
             QString aStatus = getState(option,widget);
-            if (aStatus.startsWith("focused")
+            if (aStatus.startsWith(QLatin1String("focused"))
                 && !widget->rect().contains(widget->mapFromGlobal(QCursor::pos()))) // hover bug
             {
-              aStatus.replace("focused","normal");
+              aStatus.replace(QLatin1String("focused"),QLatin1String("normal"));
             }
 
             /* use the "flat" indicator with flat buttons if it exists */
-            if (aStatus.startsWith("normal")
+            if (aStatus.startsWith(QLatin1String("normal"))
                 && autoraise && !drawRaised
                 && themeRndr_ && themeRndr_->isValid()
                 && flatArrowExists(dspec.element))
             {
-              QColor col = getFromRGBA(lspec.normalColor);
+              QColor col = lspec.normalColor;
               if (!col.isValid())
                 col = standardPalette().color(QPalette::ButtonText);
               QWidget* menubar = nullptr;
@@ -10337,19 +10593,19 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                 menubar = p;
               if (menubar)
               {
-                group = "MenuBar";
+                group = MenuBarClass;
                 if (mergedToolbarHeight(menubar))
-                  group = "Toolbar";
-                if (enoughContrast(col, getFromRGBA(getLabelSpec(group).normalColor)))
-                  dspec.element = "flat-"+dspec.element;
+                  group = ToolbarClass;
+                if (enoughContrast(col, getLabelSpec(group).normalColor))
+                  setSpecElement(dspec, "flat-"+dspec.element);
               }
               else if (stb)
               {
-                if (enoughContrast(col, getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
-                  dspec.element = "flat-"+dspec.element;
+                if (enoughContrast(col, getLabelSpec(ToolbarClass).normalColor))
+                  setSpecElement(dspec, "flat-"+dspec.element);
               }
               else if (p && enoughContrast(col, p->palette().color(p->foregroundRole())))
-                dspec.element = "flat-"+dspec.element;
+                setSpecElement(dspec, "flat-"+dspec.element);
             }
             fspec.right = fspec.left = 0;
             Qt::Alignment ialign = Qt::AlignLeft | Qt::AlignVCenter;
@@ -10371,11 +10627,11 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
             }
             /* distinguish between the toggled and pressed states
                only if a toggled down arrow element exists */
-            if (aStatus.startsWith("toggled")
+            if (aStatus.startsWith(QLatin1String("toggled"))
                 && !(themeRndr_ && themeRndr_->isValid()
                      && themeRndr_->elementExists(dspec.element+"-down-toggled")))
             {
-              aStatus.replace("toggled","pressed");
+              aStatus.replace(QLatin1String("toggled"),QLatin1String("pressed"));
             }
             renderIndicator(painter,
                             o.rect,
@@ -10415,20 +10671,21 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
         if ((verticalIndicators || tspec_.inline_spin_indicators)
             && opt->subControls & SC_SpinBoxUp)
         {
-          QString leGroup;
+          int leGroup;
           QLineEdit *le = widget->findChild<QLineEdit*>();
-          if ((!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-               || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+          if ((!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+               || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
               && getStylableToolbarContainer(le, true)
               && !enoughContrast(le->palette().color(QPalette::Active, QPalette::Text),
-                                 getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
+                                 getLabelSpec(ToolbarClass).normalColor))
           {
-            leGroup = "ToolbarLineEdit";
+            leGroup = ToolbarLineEditClass;
           }
           else
-            leGroup = "LineEdit";
-          const interior_spec ispec = getInteriorSpec(leGroup);
-          frame_spec fspec = getFrameSpec(leGroup);
+            leGroup = LineEditClass;
+          const widget_specs &specs = getWidgetSpecs(leGroup);
+          const interior_spec &ispec = specs.ispec;
+          frame_spec fspec = specs.fspec;
           fspec.isAttached = true;
           fspec.HPos = 1;
           if (verticalIndicators)
@@ -10496,7 +10753,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                                              ? fspec.right : 0)
                   || (sb->buttonSymbols() != QAbstractSpinBox::NoButtons
                       && sb->width() < editRect.width() + 2*tspec_.spin_button_width
-                                                        + getFrameSpec(QStringLiteral("IndicatorSpinBox")).right)
+                                                        + getFrameSpec(IndicatorSpinBoxClass).right)
                   || sb->height() < fspec.top+fspec.bottom+QFontMetrics(widget->font()).height())
               {
                 fspec.left = qMin(fspec.left,3);
@@ -10521,11 +10778,11 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                                                                   le ? le->palette().color(QPalette::Text)
                                                                   : standardPalette().color(QPalette::Text)));
 
-          QString leStatus;
-          if (isKisSlider_) leStatus = "normal";
-          else leStatus = (option->state & State_HasFocus) ? "focused" : "normal";
+          int leState;
+          if (isKisSlider_) leState = NormalState;
+          else leState = (option->state & State_HasFocus) ? FocusedState : NormalState;
           if (isWidgetInactive(widget))
-            leStatus .append("-inactive");
+            leState |= InactiveState;
           if (!(option->state & State_Enabled))
           {
             painter->save();
@@ -10533,52 +10790,52 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
           }
           bool animate(widget && widget->isEnabled()
                        && !qobject_cast<const QAbstractScrollArea*>(widget)
-                       && ((animatedWidget_ == widget && !leStatus.startsWith("normal"))
-                           || (animatedWidgetOut_ == widget && leStatus.startsWith("normal"))));
+                       && ((animatedWidget_ == widget && baseState(leState) != NormalState)
+                           || (animatedWidgetOut_ == widget && baseState(leState) == NormalState)));
 
-          QString animationStartState(animationStartState_);
+          int animationStartState = animationStartState_;
           int animationOpacity = animationOpacity_;
           if (animate)
           {
-            if (leStatus.startsWith("normal")) // -> QEvent::FocusOut
+            if (baseState(leState) == NormalState) // -> QEvent::FocusOut
             {
               animationStartState = animationStartStateOut_;
               animationOpacity = animationOpacityOut_;
             }
-            if (animationStartState == leStatus)
+            if (animationStartState == leState)
             {
               animationOpacity = 100;
-              if (leStatus.startsWith("normal"))
+              if (baseState(leState) == NormalState)
                 animationOpacityOut_ = 100;
               else
                 animationOpacity_ = 100;
             }
             else if (animationOpacity < 100)
             {
-              renderFrame(painter,r,fspec,fspec.element+"-"+animationStartState);
+              renderFrame(painter,r,fspec,fspec.elementId,animationStartState);
               if (!fillWidgetInterior)
-                renderInterior(painter,r,fspec,ispec,ispec.element+"-"+animationStartState);
+                renderInterior(painter,r,fspec,ispec,ispec.elementId,animationStartState);
             }
             painter->save();
             painter->setOpacity(static_cast<qreal>(animationOpacity)/100.0);
           }
-          renderFrame(painter,r,fspec,fspec.element+"-"+leStatus);
+          renderFrame(painter,r,fspec,fspec.elementId,leState);
           if (!fillWidgetInterior)
-            renderInterior(painter,r,fspec,ispec,ispec.element+"-"+leStatus);
+            renderInterior(painter,r,fspec,ispec,ispec.elementId,leState);
           if (animate)
           {
             painter->restore();
             if (animationOpacity >= 100)
             {
-              if (leStatus.startsWith("normal"))
-                animationStartStateOut_ = leStatus;
+              if (baseState(leState) == NormalState)
+                animationStartStateOut_ = leState;
               else
-                animationStartState_ = leStatus;
+                animationStartState_ = leState;
             }
           }
           if (fillWidgetInterior) // widget isn't null
           {
-            QColor baseCol = widget->palette().color(leStatus.contains("-inctive")
+            QColor baseCol = widget->palette().color(isInactiveState(leState)
                                                        ? QPalette::Inactive
                                                        : QPalette::Active,
                                                      QPalette::Base);
@@ -10624,31 +10881,32 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
         bool rtl(opt->direction == Qt::RightToLeft);
         bool editable(opt->editable && cb && cb->lineEdit());
 
-        QString group;
-        if ((!getFrameSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty()
-             || !getInteriorSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty())
+        int group;
+        if ((!getFrameSpec(ToolbarComboBoxClass).element.isEmpty()
+             || !getInteriorSpec(ToolbarComboBoxClass).element.isEmpty())
             && getStylableToolbarContainer(cb, true))
         {
-          group = "ToolbarComboBox";
+          group = ToolbarComboBoxClass;
         }
-        else group = "ComboBox";
+        else group = ComboBoxClass;
 
-        QString leGroup;
+        int leGroup;
         if (cb
-            && (!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-                || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+            && (!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+                || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
             && getStylableToolbarContainer(cb->lineEdit(), true)
             && !enoughContrast(cb->lineEdit()->palette().color(QPalette::Active, QPalette::Text),
-                               getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor)))
+                               getLabelSpec(ToolbarClass).normalColor))
         {
-          leGroup = "ToolbarLineEdit";
+          leGroup = ToolbarLineEditClass;
         }
         else
-          leGroup = "LineEdit";
+          leGroup = LineEditClass;
 
-        label_spec lspec = getLabelSpec(group);
-        frame_spec fspec = getFrameSpec(group);
-        interior_spec ispec = getInteriorSpec(group);
+        const widget_specs &specs = getWidgetSpecs(group);
+        label_spec lspec = labelSpec(specs);
+        frame_spec fspec = specs.fspec;
+        interior_spec ispec = specs.ispec;
 
         if (!widget) // WARNING: QML has anchoring!
         {
@@ -10695,18 +10953,18 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
 
         if (opt->subControls & SC_ComboBoxFrame) // frame
         {
-          QString status =
+          int wState =
                    (option->state & State_Enabled) ?
-                    (option->state & State_On) ? "toggled" :
+                    (option->state & State_On) ? ToggledState :
                     (option->state & State_MouseOver)
                       && (!widget || widget->rect().contains(widget->mapFromGlobal(QCursor::pos()))) // hover bug
-                    ? "focused" :
+                    ? FocusedState :
                     (option->state & State_Sunken)
                     // to know it has focus
-                    || (option->state & State_Selected) ? "pressed" : "normal"
-                   : "disabled";
+                    || (option->state & State_Selected) ? PressedState : NormalState
+                   : DisabledState;
           if (isWidgetInactive(widget))
-            status.append("-inactive");
+            wState |= InactiveState;
 
           int margin = 0; // see CC_ComboBox at subControlRect
           if (opt->editable && !opt->currentIcon.isNull())
@@ -10724,7 +10982,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
 
           if (!(option->state & State_Enabled))
           {
-            status.replace("disabled","normal");
+            wState = (wState & InactiveState) | NormalState;
             painter->save();
             painter->setOpacity(DISABLED_OPACITY);
           }
@@ -10732,7 +10990,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
           {
             painter->fillRect(o.rect, option->palette.brush(QPalette::Base));
             const frame_spec fspec1 = getFrameSpec(leGroup);
-            renderFrame(painter,o.rect,fspec,fspec1.element+"-normal");
+            renderFrame(painter,o.rect,fspec,fspec1.elementId,NormalState);
           }
           else // ignore framelessness
           {
@@ -10751,28 +11009,29 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                   if (drwaAsLineEdit)
                   {
                     if (isWidgetInactive(widget))
-                      status = "focused-inactive"; // impossible
-                    else status = "focused";
+                      wState = FocusedState | InactiveState; // impossible
+                    else wState = FocusedState;
                   }
                   else
                   {
                     if (isWidgetInactive(widget))
-                      status = "pressed-inactive";
-                    else status = "pressed";
+                      wState = PressedState | InactiveState;
+                    else wState = PressedState;
                   }
                 }
                 else if (drwaAsLineEdit)
                 {
-                  if (status.startsWith("focused"))
-                    status.replace("focused","normal");
-                  else if (status.startsWith("toggled"))
-                    status.replace("toggled","normal");
+                  if (baseState(wState) == FocusedState
+                      || baseState(wState) == ToggledState)
+                  {
+                    wState = (wState & InactiveState) | NormalState;
+                  }
                 }
               }
             }
 
             /* a workaround for bad codes that change line-edit base color */
-            bool colored(editable && leGroup == "LineEdit"
+            bool colored(editable && leGroup == LineEditClass
                          && cb->lineEdit()->palette().color(QPalette::Base)
                             != standardPalette().color(QPalette::Base));
 
@@ -10826,7 +11085,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
             bool libreoffice = false;
             if (isLibreoffice_ && widget == nullptr && (option->state & State_Enabled))
             {
-              if (enoughContrast(getFromRGBA(lspec.normalColor), standardPalette().color(QPalette::ButtonText)))
+              if (enoughContrast(lspec.normalColor, standardPalette().color(QPalette::ButtonText)))
               {
                 libreoffice = true;
                 painter->fillRect(option->rect, standardPalette().brush(QPalette::Window));
@@ -10843,7 +11102,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                                        && hasHighContrastWithContainer(widget,
                                                                        drwaAsLineEdit && editable
                                                                        ? cb->lineEdit()->palette().color(QPalette::Text)
-                                                                       : getFromRGBA(getLabelSpec(group).normalColor))));
+                                                                       : getLabelSpec(group).normalColor)));
 
               QStyleOptionComboBox leOpt(*opt);
               if (!drwaAsLineEdit && editable)
@@ -10852,24 +11111,21 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                                              rtl ? editWidth-o.rect.width() : 0, 0);
               }
               bool mouseAnimation(animatedWidget_ == widget
-                                  && (!status.startsWith("normal")
+                                  && (baseState(wState) != NormalState
                                       || ((!editable || !drwaAsLineEdit
                                            || (cb->view() && cb->view()->isVisible()))
-                                          && animationStartState_.startsWith("focused"))));
+                                          && baseState(animationStartState_) == FocusedState)));
               bool animate(cb && cb->isEnabled()
                            && (mouseAnimation
-                               || (animatedWidgetOut_ == widget && status.startsWith("normal"))));
-              QString animationStartState(animationStartState_);
-              if (animationStartState.startsWith("c-"))
-                animationStartState.remove(0, 2);
+                               || (animatedWidgetOut_ == widget && baseState(wState) == NormalState)));
+              int animationStartState = animationStartState_ & ~ComboState;
               int animationOpacity = animationOpacity_;
               bool animatePanel(!(tspec_.combo_focus_rect
                                   && (!drwaAsLineEdit || !editable)
-                                  && (status.startsWith("normal")
-                                      || status.startsWith("pressed"))
-                                  && (animationStartState.startsWith("normal")
-                                      || animationStartState.startsWith("pressed"))));
-              QString _status;
+                                  && (baseState(wState) == NormalState
+                                      || baseState(wState) == PressedState)
+                                  && (baseState(animationStartState) == NormalState
+                                      || baseState(animationStartState) == PressedState)));
               if (animate)
               {
                 if (!mouseAnimation) // -> QEvent::FocusOut
@@ -10877,7 +11133,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                   animationStartState = animationStartStateOut_;
                   animationOpacity = animationOpacityOut_;
                 }
-                if (animationStartState == status)
+                if (animationStartState == wState)
                 {
                   animationOpacity = 100;
                   if (!mouseAnimation)
@@ -10889,12 +11145,12 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                 {
                   if (animatePanel)
                   {
-                    _status = animationStartState;
-                    if (tspec_.combo_focus_rect)
-                      _status.replace("pressed", "normal");
-                    renderFrame(painter,r,fspec,fspec.element+"-"+_status);
+                    int _status = animationStartState;
+                    if (tspec_.combo_focus_rect && baseState(_status) == PressedState)
+                      _status = (_status & InactiveState) | NormalState;
+                    renderFrame(painter,r,fspec,fspec.elementId,_status);
                     if (!fillWidgetInterior)
-                      renderInterior(painter,r,fspec,ispec,ispec.element+"-"+_status);
+                      renderInterior(painter,r,fspec,ispec,ispec.elementId,_status);
                   }
                   if (!drwaAsLineEdit && editable)
                   {
@@ -10911,16 +11167,16 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                   painter->setOpacity(static_cast<qreal>(animationOpacity)/100.0);
                 }
               }
-              _status = status;
-              if (tspec_.combo_focus_rect)
-                _status.replace("pressed", "normal");
-              renderFrame(painter,r,fspec,fspec.element+"-"+_status);
+              int _state = wState;
+              if (tspec_.combo_focus_rect && baseState(_state) == PressedState)
+                _state = (_state & InactiveState) | NormalState;
+              renderFrame(painter,r,fspec,fspec.elementId,_state);
               if (!fillWidgetInterior)
-                renderInterior(painter,r,fspec,ispec,ispec.element+"-"+_status);
+                renderInterior(painter,r,fspec,ispec,ispec.elementId,_state);
               if (!drwaAsLineEdit && editable)
               {
                 /* draw combo icon separator if it exists */
-                const QString sepName = fspec.element + "-icon-separator";
+                const int sepId = suffixElementId(fspec.elementId,IconSeparatorSuffix);
                 QRect sep;
                 if (rtl)
                 {
@@ -10932,12 +11188,12 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                 }
                 else
                   sep = QRect (x+r.width()-fspec.right, y+fspec.top, fspec.right, h-fspec.top-fspec.bottom);
-                if (renderElement(painter, sepName+"-"+_status, sep))
+                if (renderElement(painter, stateElementId(sepId,_state), sep))
                 {
                   sep.adjust(0, -fspec.top, 0, -h+fspec.top+fspec.bottom);
-                  renderElement(painter, sepName+"-top-"+_status, sep);
+                  renderElement(painter, stateElementId(suffixElementId(sepId,TopSuffix),_state), sep);
                   sep.adjust(0, h-fspec.bottom, 0, h-fspec.top);
-                  renderElement(painter, sepName+"-bottom-"+_status, sep);
+                  renderElement(painter, stateElementId(suffixElementId(sepId,BottomSuffix),_state), sep);
                 }
                 if (rtl)
                   painter->restore();
@@ -10961,27 +11217,27 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                 {
                   if (!mouseAnimation)
                   {
-                    animationStartStateOut_ = status;
+                    animationStartStateOut_ = wState;
                     if (!editable && animatedWidget_ == widget)
-                      animationStartState_ = status;
+                      animationStartState_ = wState;
                   }
                   else
-                    animationStartState_ = status;
+                    animationStartState_ = wState;
                   // distinguish between toggled combo and toggled button
-                  if (animationStartState_.startsWith("toggled"))
-                    animationStartState_ = "c-" + animationStartState_;
+                  if (baseState(animationStartState_) == ToggledState)
+                    animationStartState_ |= ComboState;
                 }
               }
               if (fillWidgetInterior) // widget isn't null
               {
                 QColor comboCol;
                 if (colored)
-                  comboCol = cb->lineEdit()->palette().color(status.contains("-inactive")
+                  comboCol = cb->lineEdit()->palette().color(isInactiveState(wState)
                                                               ? QPalette::Inactive
                                                               : QPalette::Active,
                                                              QPalette::Base);
                 else
-                  comboCol = widget->palette().color(status.contains("-inactive")
+                  comboCol = widget->palette().color(isInactiveState(wState)
                                                        ? QPalette::Inactive
                                                        : QPalette::Active,
                                                      drwaAsLineEdit
@@ -11020,13 +11276,13 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
               if (!llist.isEmpty())
               {
                 QColor col;
-                col = getFromRGBA(lspec.normalColor);
-                if (status.startsWith("pressed"))
-                  col = getFromRGBA(lspec.pressColor);
-                else if (status.startsWith("toggled"))
-                  col = getFromRGBA(lspec.toggleColor);
+                col = lspec.normalColor;
+                if (baseState(wState) == PressedState)
+                  col = lspec.pressColor;
+                else if (baseState(wState) == ToggledState)
+                  col = lspec.toggleColor;
                 else if (option->state & State_MouseOver)
-                  col = getFromRGBA(lspec.focusColor);
+                  col = lspec.focusColor;
                 if (col.isValid())
                 {
                   opacifyColor(col);
@@ -11057,25 +11313,25 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
             int state = 1;
             if (!(option->state & State_Enabled))
               state = 0;
-            else if (status.startsWith("pressed"))
+            else if (baseState(wState) == PressedState)
               state = 3;
-            else if (status.startsWith("toggled"))
+            else if (baseState(wState) == ToggledState)
               state = 4;
-            else if (status.startsWith("focused"))
+            else if (baseState(wState) == FocusedState)
               state = 2;
 
             if (editable && drwaAsLineEdit)
             {
               /* correct the state and colors */
               if (state > 1) state = 1;
-              if (leGroup == "LineEdit")
+              if (leGroup == LineEditClass)
               {
-                lspec.normalColor = getName(widget->palette().color(QPalette::Active,QPalette::Text));
-                lspec.normalInactiveColor = getName(widget->palette().color(QPalette::Inactive,QPalette::Text));
+                lspec.normalColor = widget->palette().color(QPalette::Active,QPalette::Text);
+                lspec.normalInactiveColor = widget->palette().color(QPalette::Inactive,QPalette::Text);
               }
               else
               {
-                const label_spec tlspec = getLabelSpec(QStringLiteral("Toolbar"));
+                const label_spec tlspec = getLabelSpec(ToolbarClass);
                 lspec.normalColor = tlspec.normalColor;
                 lspec.normalInactiveColor = tlspec.normalInactiveColor;
               }
@@ -11098,7 +11354,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
               }
             }
             QPixmap icn = getPixmapFromIcon(opt->currentIcon,
-                                            getIconMode(state,status.contains("-inactive"),lspec),
+                                            getIconMode(state,isInactiveState(wState),lspec),
                                             iconstate, opt->iconSize);
             QRect iconRect = alignedRect(option->direction,
                                          Qt::AlignVCenter | Qt::AlignLeft,
@@ -11220,7 +11476,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
         ********************/
         if (opt->subControls & SC_ScrollBarSlider)
         {
-          const QString group = "ScrollbarGroove";
+          const int group = ScrollbarGrooveClass;
           frame_spec fspec = getFrameSpec(group);
           fspec.expansion = 0; // no need to frame expansion because the thickness is known
           const interior_spec ispec = getInteriorSpec(group);
@@ -11322,7 +11578,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                we draw the glow first because the slider may be rounded */
             if (option->state & State_Enabled)
             {
-              const frame_spec sFspec = getFrameSpec(QStringLiteral("ScrollbarSlider"));
+              const frame_spec sFspec = getFrameSpec(ScrollbarSliderClass);
               int glowH = 2*extent;
               int topGlowY, bottomGlowY, topGlowH, bottomGlowH;
               if (horiz)
@@ -11408,9 +11664,10 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
 
       if (opt)
       {
-        QString group = "Slider";
-        frame_spec fspec = getFrameSpec(group);
-        interior_spec ispec = getInteriorSpec(group);
+        int group = SliderClass;
+        const widget_specs &specs = getWidgetSpecs(SliderClass);
+        frame_spec fspec = specs.fspec;
+        interior_spec ispec = specs.ispec;
         fspec.expansion = 0;
 
         bool horiz = opt->orientation == Qt::Horizontal; // this is more reliable than option->state
@@ -11624,7 +11881,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
         ************/
         if (opt->subControls & SC_SliderHandle) // I haven't seen a slider without handle
         {
-          group = "SliderCursor";
+          group = SliderCursorClass;
           fspec = getFrameSpec(group);
           ispec = getInteriorSpec(group);
           fspec.expansion = 0;
@@ -11693,37 +11950,38 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
           else if (ticks == QSlider::NoTicks
                    && ticklessSliderHandleSize_ > 0)
           { // see pixelMetric() -> PM_SliderLength
-            ispec.element += "-tickless";
-            fspec.element += "-tickless";
+            setSpecElement(ispec, ispec.element+"-tickless");
+            setSpecElement(fspec, fspec.element+"-tickless");
           }
 
-          QString status = getState(option,widget);
+          const int wState = getWidgetState(option,widget);
           bool animate(widget && widget->isEnabled() && animatedWidget_ == widget
                        && !qobject_cast<const QAbstractScrollArea*>(widget));
           if (animate)
           {
-            if (animationStartState_ == status)
+            if (animationStartState_ == wState)
               animationOpacity_ = 100;
             else if (animationOpacity_ < 100)
-            {
-              renderFrame(painter,r,fspec,fspec.element+"-"+animationStartState_);
-              renderInterior(painter,r,fspec,ispec,ispec.element+"-"+animationStartState_);
-            }
+              renderAnimatedPanel(painter,widget,r,fspec,ispec,animationStartState_);
             painter->save();
             painter->setOpacity(static_cast<qreal>(animationOpacity_)/100.0);
+            renderAnimatedPanel(painter,widget,r,fspec,ispec,wState);
+          }
+          else
+          {
+            renderFrame(painter,r,fspec,fspec.elementId,wState);
+            renderInterior(painter,r,fspec,ispec,ispec.elementId,wState);
           }
-          renderFrame(painter,r,fspec,fspec.element+"-"+status);
-          renderInterior(painter,r,fspec,ispec,ispec.element+"-"+status);
           if (animate)
           {
             painter->restore();
             if (animationOpacity_ >= 100)
-              animationStartState_ = status;
+              animationStartState_ = wState;
           }
 
           // a decorative indicator if its element exists
           const indicator_spec dspec = getIndicatorSpec(group);
-          renderIndicator(painter,r,fspec,dspec,dspec.element+"-"+status,option->direction);
+          renderIndicator(painter,r,fspec,dspec,dspec.elementId,wState,option->direction);
 
           if (derive)
             painter->restore();
@@ -11786,10 +12044,10 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
 
       if (opt) {
         int ts = opt->titleBarState;
-        const QString tbStatus =
-              (ts & Qt::WindowActive) ? "focused" : "normal";
+        const int tbState =
+              (ts & Qt::WindowActive) ? FocusedState : NormalState;
 
-        const QString group = "TitleBar";
+        const int group = TitleBarClass;
         frame_spec fspec;
         default_frame_spec(fspec);
         const interior_spec ispec = getInteriorSpec(group);
@@ -11801,7 +12059,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
           // SH_TitleBar_NoBorder is set to be true
           //QString status = getState(option,widget);
           //renderFrame(painter,o.rect,fspec,fspec.element+"-"+status);
-          renderInterior(painter,o.rect,fspec,ispec,ispec.element+"-"+tbStatus);
+          renderInterior(painter,o.rect,fspec,ispec,ispec.elementId,tbState);
 
           /* do what's done in PE_FrameWindow */
           QColor shadow(0,0,0,55);
@@ -11834,7 +12092,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                       o.rect,
                       fspec,lspec,
                       Qt::AlignCenter,title,QPalette::WindowText,
-                      tbStatus == "normal" ? 1 : 2,
+                      tbState == NormalState ? 1 : 2,
                       false,
                       getPixmapFromIcon(o.icon,Normal,QIcon::Off,iconSize),
                       iconSize);
@@ -11850,7 +12108,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                           dspec.element+"-close-"
                             + ((opt->activeSubControls & QStyle::SC_TitleBarCloseButton) ?
                                 (option->state & State_Sunken) ? "pressed" : "focused"
-                                  : tbStatus == "focused" ? "normal" : "disabled"),
+                                  : tbState == FocusedState ? "normal" : "disabled"),
                           option->direction);
         if ((opt->subControls & SC_TitleBarMaxButton) && (tf & Qt::WindowMaximizeButtonHint)
             && !(ts & Qt::WindowMaximized))
@@ -11860,7 +12118,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                           dspec.element+"-maximize-"
                             + ((opt->activeSubControls & QStyle::SC_TitleBarMaxButton) ?
                                 (option->state & State_Sunken) ? "pressed" : "focused"
-                                  : tbStatus == "focused" ? "normal" : "disabled"),
+                                  : tbState == FocusedState ? "normal" : "disabled"),
                           option->direction);
         if ((opt->subControls & SC_TitleBarMinButton) && (tf & Qt::WindowMinimizeButtonHint)
             && !(ts & Qt::WindowMinimized))
@@ -11870,7 +12128,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                           dspec.element+"-minimize-"
                             + ((opt->activeSubControls & QStyle::SC_TitleBarMinButton) ?
                                 (option->state & State_Sunken) ? "pressed" : "focused"
-                                  : tbStatus == "focused" ? "normal" : "disabled"),
+                                  : tbState == FocusedState ? "normal" : "disabled"),
                           option->direction);
         if ((opt->subControls & SC_TitleBarNormalButton)
             && (((tf & Qt::WindowMinimizeButtonHint) && (ts & Qt::WindowMinimized))
@@ -11881,7 +12139,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                           dspec.element+"-restore-"
                             + ((opt->activeSubControls & QStyle::SC_TitleBarNormalButton) ?
                                 (option->state & State_Sunken) ? "pressed" : "focused"
-                                  : tbStatus == "focused" ? "normal" : "disabled"),
+                                  : tbState == FocusedState ? "normal" : "disabled"),
                           option->direction);
         if ((opt->subControls & SC_TitleBarShadeButton) && (tf & Qt::WindowShadeButtonHint)
             && !(ts & Qt::WindowMinimized))
@@ -11891,7 +12149,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                           dspec.element+"-shade-"
                             + ((opt->activeSubControls & QStyle::SC_TitleBarShadeButton) ?
                                 (option->state & State_Sunken) ? "pressed" : "focused"
-                                  : tbStatus == "focused" ? "normal" : "disabled"),
+                                  : tbState == FocusedState ? "normal" : "disabled"),
                           option->direction);
         if ((opt->subControls & SC_TitleBarUnshadeButton) && (tf & Qt::WindowShadeButtonHint)
             && (ts & Qt::WindowMinimized))
@@ -11901,7 +12159,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
                           dspec.element+"-restore-"
                             + ((opt->activeSubControls & QStyle::SC_TitleBarUnshadeButton) ?
                                 (option->state & State_Sunken) ? "pressed" : "focused"
-                                  : tbStatus == "focused" ? "normal" : "disabled"),
+                                  : tbState == FocusedState ? "normal" : "disabled"),
                           option->direction);
         if ((opt->subControls & SC_TitleBarContextHelpButton)&& (ts & Qt::WindowContextHelpButtonHint))
           break;
@@ -12070,12 +12328,12 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
         {
           if (opt->state & State_HasFocus)
           {
-            const frame_spec fspec = getFrameSpec(QStringLiteral("GroupBox"));
+            const frame_spec fspec = getFrameSpec(GroupBoxClass);
             int spacing = tspec_.groupbox_top_label ? pixelMetric(PM_CheckBoxLabelSpacing)/2 : 0;
             if (fspec.hasFocusFrame)
             {
               renderFrame(painter,textRect.adjusted(-spacing,0,spacing,0),fspec,fspec.element+"-focus");
-              const interior_spec ispec = getInteriorSpec(QStringLiteral("GroupBox"));
+              const interior_spec ispec = getInteriorSpec(GroupBoxClass);
               if (ispec.hasFocusInterior)
                 renderInterior(painter,textRect.adjusted(-spacing,0,spacing,0),fspec,ispec,ispec.element+"-focus");
             }
@@ -12087,7 +12345,7 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
           }
 
           bool isInactive(isWidgetInactive(widget));
-          const label_spec lspec = getLabelSpec(QStringLiteral("GroupBox"));
+          const label_spec lspec = getLabelSpec(GroupBoxClass);
           QColor col;
           if (!(option->state & State_Enabled))
             col = standardPalette().color(QPalette::Disabled,QPalette::Text);
@@ -12095,23 +12353,23 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.focusInactiveColor);
+              col = lspec.focusInactiveColor;
               if (!col.isValid())
-               col = getFromRGBA(lspec.focusColor);
+               col = lspec.focusColor;
             }
             else
-              col = getFromRGBA(lspec.focusColor);
+              col = lspec.focusColor;
           }
           else
           {
             if (isInactive)
             {
-              col = getFromRGBA(lspec.normalInactiveColor);
+              col = lspec.normalInactiveColor;
               if (!col.isValid())
-               col = getFromRGBA(lspec.normalColor);
+               col = lspec.normalColor;
             }
             else
-              col = getFromRGBA(lspec.normalColor);
+              col = lspec.normalColor;
           }
 
           if (!col.isValid()) // make it always valid
@@ -12139,12 +12397,12 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
             QColor shadowColor;
             if (isInactive)
             {
-              shadowColor = getFromRGBA(lspec.inactiveShadowColor);
+              shadowColor = lspec.inactiveShadowColor;
               if (!shadowColor.isValid())
-                shadowColor = getFromRGBA(lspec.shadowColor);
+                shadowColor = lspec.shadowColor;
             }
             else
-              shadowColor = getFromRGBA(lspec.shadowColor);
+              shadowColor = lspec.shadowColor;
 
             /* the shadow should have enough contrast with the text */
             if (enoughContrast(col, shadowColor))
@@ -12203,7 +12461,83 @@ void Style::drawComplexControl(QStyle::ComplexControl control,
   }
 }
 
+bool Style::isThemeMetric(QStyle::PixelMetric metric)
+{
+  switch (metric) {
+    case PM_ButtonMargin :
+    case PM_ButtonShiftHorizontal :
+    case PM_ButtonShiftVertical :
+    case PM_SpinBoxFrameWidth :
+    case PM_ComboBoxFrameWidth :
+    case PM_MdiSubWindowFrameWidth :
+    case PM_MdiSubWindowMinimizedWidth :
+    case PM_LayoutLeftMargin :
+    case PM_LayoutRightMargin :
+    case PM_LayoutTopMargin :
+    case PM_LayoutBottomMargin :
+    case PM_LayoutHorizontalSpacing :
+    case PM_LayoutVerticalSpacing :
+    case PM_MenuBarPanelWidth :
+    case PM_MenuBarVMargin :
+    case PM_MenuBarHMargin :
+    case PM_MenuBarItemSpacing :
+    case PM_MenuPanelWidth :
+    case PM_MenuDesktopFrameWidth :
+    case PM_ToolBarFrameWidth :
+    case PM_ToolBarItemSpacing :
+    case PM_ToolBarHandleExtent :
+    case PM_ToolBarSeparatorExtent :
+    case PM_ToolBarIconSize :
+    case PM_ToolBarExtensionExtent :
+    case PM_ToolBarItemMargin :
+    case PM_TabBarTabOverlap :
+    case PM_TabBarBaseHeight :
+    case PM_TabBarTabShiftHorizontal :
+    case PM_TabBarTabShiftVertical :
+    case PM_TabBar_ScrollButtonOverlap :
+    case PM_ScrollView_ScrollBarOverlap :
+    case PM_TabBarScrollButtonWidth :
+    case PM_TabCloseIndicatorWidth :
+    case PM_TabCloseIndicatorHeight :
+    case PM_TabBarIconSize :
+    case PM_ListViewIconSize :
+    case PM_ButtonIconSize :
+    case PM_SmallIconSize :
+    case PM_IconViewIconSize :
+    case PM_LargeIconSize :
+    case PM_CheckBoxLabelSpacing :
+    case PM_RadioButtonLabelSpacing :
+    case PM_SplitterWidth :
+    case PM_ProgressBarChunkWidth :
+    case PM_DockWidgetSeparatorExtent :
+    case PM_DockWidgetFrameWidth :
+    case PM_DockWidgetTitleMargin :
+    case PM_TitleBarButtonSize :
+    case PM_TitleBarButtonIconSize :
+    case PM_TextCursorWidth :
+    case PM_HeaderMargin : return true;
+
+    default : return false;
+  }
+}
+
 int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, const QWidget *widget) const
+{
+  /* layouts ask for these metrics very often but they
+     don't change until the theme is set again */
+  if (isThemeMetric(metric))
+  {
+    QHash<int, int>::const_iterator it = themeMetrics_.constFind(metric);
+    if (it != themeMetrics_.constEnd())
+      return it.value();
+    int res = computePixelMetric(metric,nullptr,nullptr);
+    themeMetrics_.insert(metric, res);
+    return res;
+  }
+  return computePixelMetric(metric,option,widget);
+}
+
+int Style::computePixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, const QWidget *widget) const
 {
   switch (metric) {
     case PM_ButtonMargin : return 0;
@@ -12222,7 +12556,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
                                          or, improbably, shadow and horizontal menu frames are both zero */
           return qMax(hMargin, pixelMetric(PM_MenuVMargin,option,widget));
       }
-      const frame_spec fspec = getFrameSpec(QStringLiteral("GenericFrame"));
+      const frame_spec fspec = getFrameSpec(GenericFrameClass);
       /* NOTE: There is an old RTL bug in Qt, due to which, some frames -- especially
                those inside splitters -- may be cut at the right with RTL. Unfortunately,
                here the layout direction may not be reported correctly. As a workaround,
@@ -12256,9 +12590,9 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
                 be used but Qt has a bug about menubar corner widgets,
                 that would show up badly if they were used. */
       if (tspec_.merge_menubar_with_toolbar)
-        return getFrameSpec(QStringLiteral("Toolbar")).left;
+        return getFrameSpec(ToolbarClass).left;
       else
-        return getFrameSpec(QStringLiteral("MenuBar")).left;
+        return getFrameSpec(MenuBarClass).left;
     }
 
     case PM_MenuPanelWidth :
@@ -12309,7 +12643,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
       }
 
       //if (isLibreoffice_) return QCommonStyle::pixelMetric(metric,option,widget);
-      const frame_spec fspec = getFrameSpec(QStringLiteral("Menu"));
+      const frame_spec fspec = getFrameSpec(MenuClass);
       int v = qMax(fspec.top,fspec.bottom);
       int h = 0;
       theme_spec tspec_now = settings_->getCompositeSpec();
@@ -12393,7 +12727,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
       if (widget && widget->testAttribute(Qt::WA_StyleSheetTarget)) // not drawn by Kvantum
         return QCommonStyle::pixelMetric(metric,option,widget);
 #endif
-      const indicator_spec dspec = getIndicatorSpec(QStringLiteral("MenuItem"));
+      const indicator_spec dspec = getIndicatorSpec(MenuItemClass);
       return qMax(pixelMetric(PM_MenuVMargin,option,widget), dspec.size);
     }
 
@@ -12402,7 +12736,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
     case PM_ToolBarHandleExtent : {
       if (tspec_.center_toolbar_handle)
       {
-        const indicator_spec dspec = getIndicatorSpec(QStringLiteral("Toolbar"));
+        const indicator_spec dspec = getIndicatorSpec(ToolbarClass);
         return dspec.size + 3
                /* a minimum margin of 3 px */
                + qMax(3 - pixelMetric(PM_ToolBarItemMargin,option,widget)
@@ -12412,7 +12746,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
       return 8;
     }
     case PM_ToolBarSeparatorExtent : {
-      const indicator_spec dspec = getIndicatorSpec(QStringLiteral("Toolbar"));
+      const indicator_spec dspec = getIndicatorSpec(ToolbarClass);
       return qMax(tspec_.toolbar_separator_thickness, qMax(dspec.size,4));
     }
     case PM_ToolBarIconSize : return tspec_.toolbar_icon_size;
@@ -12420,7 +12754,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
        but it's used in Qt -> qtoolbarextension.cpp, qtoolbarlayout.cpp and qmenubar.cpp */
     case PM_ToolBarExtensionExtent : return 16;
     case PM_ToolBarItemMargin : {
-      const frame_spec fspec = getFrameSpec(QStringLiteral("Toolbar"));
+      const frame_spec fspec = getFrameSpec(ToolbarClass);
       int v = qMax(fspec.top,fspec.bottom);
       int h = qMax(fspec.left,fspec.right);
       return qMax(v,h);
@@ -12431,11 +12765,11 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
        QCommonStyle uses it on the right and left tab sides equally
        but we do so only when the right and left tab buttons exist. */
     case PM_TabBarTabHSpace : {
-      const frame_spec fspec = getFrameSpec(QStringLiteral("Tab"));
+      const frame_spec fspec = getFrameSpec(TabClass);
       int hSpace = qMax(fspec.left,fspec.right)*2;
       if (!widget) // QML
       {
-        const label_spec lspec = getLabelSpec(QStringLiteral("Tab"));
+        const label_spec lspec = getLabelSpec(TabClass);
         int common = QCommonStyle::pixelMetric(metric,option,widget);
         hSpace += qMax(lspec.left,lspec.right)*2;
         hSpace = qMax(hSpace, common);
@@ -12445,8 +12779,8 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
     case PM_TabBarTabVSpace : {
       if (!widget) // QML
       {
-        const frame_spec fspec = getFrameSpec(QStringLiteral("Tab"));
-        const label_spec lspec = getLabelSpec(QStringLiteral("Tab"));
+        const frame_spec fspec = getFrameSpec(TabClass);
+        const label_spec lspec = getLabelSpec(TabClass);
         int common = QCommonStyle::pixelMetric(metric,option,widget);
         return qMax(fspec.top+fspec.bottom + lspec.top+lspec.bottom
                       + 1, // WARNING: Why QML tabs are cut by 1px from below?
@@ -12501,8 +12835,8 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
     }
 
     case PM_TabBarScrollButtonWidth : {
-      const frame_spec fspec1 = getFrameSpec(QStringLiteral("PanelButtonTool"));
-      const frame_spec fspec2 = getFrameSpec(QStringLiteral("Tab"));
+      const frame_spec fspec1 = getFrameSpec(PanelButtonToolClass);
+      const frame_spec fspec2 = getFrameSpec(TabClass);
       return qMax(pixelMetric(PM_TabCloseIndicatorWidth)
                     + qMin(qMax(fspec1.left, fspec1.right),
                            qMax(fspec2.left, fspec2.right))
@@ -12512,7 +12846,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
 
     case PM_TabCloseIndicatorWidth :
     case PM_TabCloseIndicatorHeight : {
-       return getIndicatorSpec(QStringLiteral("Tab")).size;
+       return getIndicatorSpec(TabClass).size;
     }
 
     case PM_TabBarIconSize :
@@ -12531,9 +12865,10 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
          (-> Qt ->qcommonstyle.cpp). It seems that apart from
          viewitems, it's only used for CT_ComboBox, whose default
          size I don't use. */
-      const QString group = "ItemView";
-      const frame_spec fspec = getFrameSpec(group);
-      const label_spec lspec = getLabelSpec(group);
+      const int group = ItemViewClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      const frame_spec &fspec = specs.fspec;
+      const label_spec &lspec = labelSpec(specs);
       if (metric == PM_FocusFrameHMargin)
         margin += qMax(fspec.left+lspec.left, fspec.right+lspec.right);
       else
@@ -12603,7 +12938,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
         {
           if (ticklessSliderHandleSize_ == -1)
           {
-            const interior_spec ispec = getInteriorSpec(QStringLiteral("SliderCursor"));
+            const interior_spec ispec = getInteriorSpec(SliderCursorClass);
             if (elementExists(ispec.element+"-tickless-normal"))
             {
               if (tspec_.tickless_slider_handle_size > 0)
@@ -12651,9 +12986,10 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
     }
 
     case PM_DockWidgetTitleMargin : {
-      const QString group = "DockTitle";
-      const label_spec lspec = getLabelSpec(group);
-      const frame_spec fspec = getFrameSpec(group);
+      const int group = DockTitleClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      const label_spec &lspec = labelSpec(specs);
+      const frame_spec &fspec = specs.fspec;
       int v = qMax(lspec.top+fspec.top, lspec.bottom+fspec.bottom);
       int h = qMax(lspec.left+fspec.left, lspec.right+fspec.right);
       return qMax(v,h);
@@ -12664,7 +13000,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
 
     case PM_TitleBarHeight : {
       // respect the text margins
-      const label_spec lspec = getLabelSpec(QStringLiteral("TitleBar"));
+      const label_spec lspec = getLabelSpec(TitleBarClass);
       int v = lspec.top + lspec.bottom;
       int b = 0;
       if (widget && lspec.boldFont)
@@ -12684,7 +13020,7 @@ int Style::pixelMetric(QStyle::PixelMetric metric, const QStyleOption *option, c
     case PM_HeaderMargin : return 2;
 
     case PM_ToolTipLabelFrameWidth : {
-      const frame_spec fspec = getFrameSpec(QStringLiteral("ToolTip"));
+      const frame_spec fspec = getFrameSpec(ToolTipClass);
 
       int v = qMax(fspec.top,fspec.bottom);
       int h = qMax(fspec.left,fspec.right);
@@ -13031,7 +13367,7 @@ int Style::styleHint(QStyle::StyleHint hint,
     }
 
     case SH_GroupBox_TextLabelColor: {
-      const label_spec lspec = getLabelSpec(QStringLiteral("GroupBox"));
+      const label_spec lspec = getLabelSpec(GroupBoxClass);
       QColor col;
       if (option && !(option->state & State_Enabled))
       {
@@ -13040,7 +13376,7 @@ int Style::styleHint(QStyle::StyleHint hint,
       }
       else if (option && (option->state & State_MouseOver))
       {
-        col = getFromRGBA(lspec.focusColor);
+        col = lspec.focusColor;
         if (col.isValid())
         {
           opacifyColor(col);
@@ -13049,7 +13385,7 @@ int Style::styleHint(QStyle::StyleHint hint,
       }
       else
       {
-        col = getFromRGBA(lspec.normalColor);
+        col = lspec.normalColor;
         if (col.isValid())
         {
           opacifyColor(col);
@@ -13160,12 +13496,12 @@ int Style::extraComboWidth(const QStyleOptionComboBox *opt, bool hasIcon) const
   if (opt == nullptr) return 0;
   int res = 0;
 
-  const frame_spec fspec = getFrameSpec(QStringLiteral("ComboBox"));
-  const size_spec sspec = getSizeSpec(QStringLiteral("ComboBox"));
-  const label_spec lspec = getLabelSpec(QStringLiteral("ComboBox"));
-  const frame_spec fspec1 = getFrameSpec(QStringLiteral("LineEdit"));
-  const label_spec lspec1 = getLabelSpec(QStringLiteral("LineEdit"));
-  const size_spec sspec1 = getSizeSpec(QStringLiteral("LineEdit"));
+  const frame_spec fspec = getFrameSpec(ComboBoxClass);
+  const size_spec sspec = getSizeSpec(ComboBoxClass);
+  const label_spec lspec = getLabelSpec(ComboBoxClass);
+  const frame_spec fspec1 = getFrameSpec(LineEditClass);
+  const label_spec lspec1 = getLabelSpec(LineEditClass);
+  const size_spec sspec1 = getSizeSpec(LineEditClass);
   bool rtl(opt->direction == Qt::RightToLeft);
 
   /* We don't add COMBO_ARROW_LENGTH (=20) to the width because
@@ -13215,9 +13551,10 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
       if (widget) f = widget->font();
       else f = QApplication::font();
 
-      const QString group = "LineEdit";
-      const frame_spec fspec = getFrameSpec(group);
-      size_spec sspec = getSizeSpec(group);
+      const int group = LineEditClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      const frame_spec &fspec = specs.fspec;
+      size_spec sspec = specs.sspec;
       /* the label spec is only used for vertical spacing */
       const label_spec lspec = getLabelSpec(group);
 
@@ -13249,7 +13586,7 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
          which in turn was based on SC_SpinBoxEditField (Qt4 -> qabstractspinbox.cpp).
          That's corrected in Qt5 but the following method is always reliable. */
       const QAbstractSpinBox *sb = qobject_cast<const QAbstractSpinBox*>(widget);
-      frame_spec fspec = getFrameSpec(QStringLiteral("LineEdit"));
+      frame_spec fspec = getFrameSpec(LineEditClass);
       if (tspec_.vertical_spin_indicators
           && !(sb && sb->buttonSymbols() == QAbstractSpinBox::NoButtons))
       {
@@ -13258,10 +13595,10 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         fspec.top = qMin(fspec.top,3);
         fspec.bottom = qMin(fspec.bottom,3);
       }
-      const label_spec lspec = getLabelSpec(QStringLiteral("LineEdit"));
-      const size_spec sspecLE = getSizeSpec(QStringLiteral("LineEdit"));
-      const frame_spec fspec1 = getFrameSpec(QStringLiteral("IndicatorSpinBox"));
-      const size_spec sspec = getSizeSpec(QStringLiteral("IndicatorSpinBox"));
+      const label_spec lspec = getLabelSpec(LineEditClass);
+      const size_spec sspecLE = getSizeSpec(LineEditClass);
+      const frame_spec fspec1 = getFrameSpec(IndicatorSpinBoxClass);
+      const size_spec sspec = getSizeSpec(IndicatorSpinBoxClass);
       if (sb)
       {
         QString maxTxt = spinMaxText(sb);
@@ -13306,11 +13643,12 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
           qstyleoption_cast<const QStyleOptionComboBox*>(option);
 
       if (opt) {
-        const QString group = "ComboBox";
-        const frame_spec fspec = getFrameSpec(group);
-        const size_spec sspec = getSizeSpec(group);
-        label_spec lspec = getLabelSpec(group);
-        const frame_spec fspec1 = getFrameSpec(QStringLiteral("LineEdit"));
+        const int group = ComboBoxClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        const frame_spec &fspec = specs.fspec;
+        const size_spec &sspec = specs.sspec;
+        label_spec lspec = labelSpec(specs);
+        const frame_spec fspec1 = getFrameSpec(LineEditClass);
 
         QFont f;
         if (widget) f = widget->font();
@@ -13373,11 +13711,12 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         qstyleoption_cast<const QStyleOptionButton*>(option);
 
       if (opt) {
-        const QString group = "PanelButtonCommand";
-        frame_spec fspec = getFrameSpec(group);
-        const indicator_spec dspec = getIndicatorSpec(group);
-        size_spec sspec = getSizeSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const int group = PanelButtonCommandClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        const indicator_spec &dspec = specs.dspec;
+        size_spec sspec = specs.sspec;
+        label_spec lspec = labelSpec(specs);
         const QString txt = opt->text;
 
         if (qobject_cast<QAbstractItemView*>(getParent(widget,2)))
@@ -13464,7 +13803,7 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         qstyleoption_cast<const QStyleOptionButton*>(option);
 
       if (opt) {
-        const QString group = "RadioButton";
+        const int group = RadioButtonClass;
         frame_spec fspec;
         default_frame_spec(fspec);
         label_spec lspec = getLabelSpec(group);
@@ -13503,7 +13842,7 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         qstyleoption_cast<const QStyleOptionButton*>(option);
 
       if (opt) {
-        const QString group = "CheckBox";
+        const int group = CheckBoxClass;
         frame_spec fspec;
         default_frame_spec(fspec);
         label_spec lspec = getLabelSpec(group);
@@ -13542,10 +13881,11 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         qstyleoption_cast<const QStyleOptionMenuItem*>(option);
 
       if (opt) {
-        const QString group = "MenuItem";
-        const frame_spec fspec = getFrameSpec(group);
-        const label_spec lspec = getLabelSpec(group);
-        const size_spec sspec = getSizeSpec(group);
+        const int group = MenuItemClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        const frame_spec &fspec = specs.fspec;
+        const label_spec &lspec = labelSpec(specs);
+        const size_spec &sspec = specs.sspec;
 
         QFont f;
         f = opt->font; // some apps (like TeXstudio) use special fonts (see CE_MenuItem)
@@ -13645,15 +13985,16 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         qstyleoption_cast<const QStyleOptionMenuItem*>(option);
 
       if (opt) {
-        QString group = "MenuBarItem";
-        frame_spec fspec = getFrameSpec(group);
-        const label_spec lspec = getLabelSpec(group);
-        const size_spec sspec = getSizeSpec(group);
+        int group = MenuBarItemClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        const label_spec &lspec = labelSpec(specs);
+        const size_spec &sspec = specs.sspec;
         frame_spec fspec1;
         if (tspec_.merge_menubar_with_toolbar)
-          fspec1 = getFrameSpec(QStringLiteral("Toolbar"));
+          fspec1 = getFrameSpec(ToolbarClass);
         else
-          fspec1 = getFrameSpec(QStringLiteral("MenuBar"));
+          fspec1 = getFrameSpec(MenuBarClass);
         /* needed for putting menubar-items inside menubar frame
            (see PM_MenuBarItemSpacing for the reason) */
         fspec.top += fspec1.top+fspec1.bottom;
@@ -13675,11 +14016,12 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         qstyleoption_cast<const QStyleOptionToolButton*>(option);
 
       if (opt) {
-        const QString group = "PanelButtonTool";
-        frame_spec fspec = getFrameSpec(group);
-        const indicator_spec dspec = getIndicatorSpec(group);
-        size_spec sspec = getSizeSpec(group);
-        label_spec lspec = getLabelSpec(group);
+        const int group = PanelButtonToolClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        const indicator_spec &dspec = specs.dspec;
+        size_spec sspec = specs.sspec;
+        label_spec lspec = labelSpec(specs);
 
         // -> CE_ToolButtonLabel
         if (qobject_cast<QAbstractItemView*>(getParent(widget,2)))
@@ -13725,7 +14067,7 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         {
           if (tb->popupMode() == QToolButton::MenuButtonPopup)
           {
-            const QString group1 = "DropDownButton";
+            const int group1 = DropDownButtonClass;
             const frame_spec fspec1 = getFrameSpec(group1);
             indicator_spec dspec1 = getIndicatorSpec(group1);
             dspec1.size = qMin(dspec1.size,qMin(defaultSize.height(),defaultSize.width()));
@@ -13792,10 +14134,11 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         qstyleoption_cast<const QStyleOptionTab*>(option);
 
       if (opt) {
-        const QString group = "Tab";
-        const frame_spec fspec = getFrameSpec(group);
-        const label_spec lspec = getLabelSpec(group);
-        const size_spec sspec = getSizeSpec(group);
+        const int group = TabClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        const frame_spec &fspec = specs.fspec;
+        const label_spec &lspec = labelSpec(specs);
+        const size_spec &sspec = specs.sspec;
 
         QFont f;
         if (widget) f = widget->font();
@@ -13900,11 +14243,12 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         qstyleoption_cast<const QStyleOptionHeader*>(option);
 
       if (opt) {
-        const QString group = "HeaderSection";
-        frame_spec fspec = getFrameSpec(group);
-        const label_spec lspec = getLabelSpec(group);
-        const size_spec sspec = getSizeSpec(group);
-        const indicator_spec dspec = getIndicatorSpec(group);
+        const int group = HeaderSectionClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        frame_spec fspec = specs.fspec;
+        const label_spec &lspec = labelSpec(specs);
+        const size_spec &sspec = specs.sspec;
+        const indicator_spec &dspec = specs.dspec;
         if (opt->orientation != Qt::Horizontal)
         {
           int t = fspec.left;
@@ -13955,10 +14299,11 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
           qstyleoption_cast<const QStyleOptionViewItem*>(option);
       if (opt)
       {
-        const QString group = "ItemView";
-        const frame_spec fspec = getFrameSpec(group);
-        const label_spec lspec = getLabelSpec(group);
-        const size_spec sspec = getSizeSpec(group);
+        const int group = ItemViewClass;
+        const widget_specs &specs = getWidgetSpecs(group);
+        const frame_spec &fspec = specs.fspec;
+        const label_spec &lspec = labelSpec(specs);
+        const size_spec &sspec = specs.sspec;
         QStyleOptionViewItem::Position pos = opt->decorationPosition;
 
         s.rheight() += fspec.top + fspec.bottom;
@@ -14019,8 +14364,8 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
           qstyleoption_cast<const QStyleOptionViewItem*>(option);
       if (opt)
       {
-        const frame_spec fspec = getFrameSpec(QStringLiteral("ItemView"));
-        const frame_spec fspec1 = getFrameSpec(QStringLiteral("PanelButtonCommand"));
+        const frame_spec fspec = getFrameSpec(ItemViewClass);
+        const frame_spec fspec1 = getFrameSpec(PanelButtonCommandClass);
         int h = opt->font.pointSize() + fspec.top + fspec.bottom + fspec1.top + fspec1.bottom;
         if (h > s.height())
           s.setHeight(h);
@@ -14030,7 +14375,7 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
     }
 
     case CT_TabWidget : {
-      const frame_spec fspec = getFrameSpec(QStringLiteral("TabFrame"));
+      const frame_spec fspec = getFrameSpec(TabFrameClass);
       s = defaultSize + QSize(fspec.left+fspec.right,
                               fspec.top+fspec.bottom);
 
@@ -14038,7 +14383,7 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
     }
 
     case CT_GroupBox : {
-      const QString group = "GroupBox";
+      const int group = GroupBoxClass;
 
       frame_spec fspec;
       default_frame_spec(fspec);
@@ -14099,7 +14444,7 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
       QFont f;
       if (widget) f = widget->font();
       else f = QApplication::font();
-      const label_spec lspec = getLabelSpec(QStringLiteral("Progressbar"));
+      const label_spec lspec = getLabelSpec(ProgressbarClass);
       if (lspec.boldFont) f.setWeight(lspec.boldness);
 
       if (!isKisSlider_ && tspec_.progressbar_thickness > 0
@@ -14116,7 +14461,7 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
         return s;
       }
       // the label of an ordianry progressbar should fit in its interior
-      const frame_spec fspec = getFrameSpec(QStringLiteral("Progressbar"));
+      const frame_spec fspec = getFrameSpec(ProgressbarClass);
       if (isVertical)
         s.rwidth() = QFontMetrics(f).height() + fspec.top + fspec.bottom;
       else
@@ -14128,9 +14473,9 @@ QSize Style::sizeFromContents(QStyle::ContentsType type,
       /* make the size larger to put buttons inside menubar frame (-> CC_MdiControls) */
       frame_spec fspec;
       if (tspec_.merge_menubar_with_toolbar)
-        fspec = getFrameSpec(QStringLiteral("Toolbar"));
+        fspec = getFrameSpec(ToolbarClass);
       else
-        fspec = getFrameSpec(QStringLiteral("MenuBar"));
+        fspec = getFrameSpec(MenuBarClass);
       const int frameWidth = (option->direction == Qt::RightToLeft ? fspec.left : fspec.right);
       if (const QStyleOptionComplex *styleOpt = qstyleoption_cast<const QStyleOptionComplex *>(option))
       {
@@ -14248,7 +14593,7 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
                               opt->rect,
                               subElementRect(isRadio ? SE_RadioButtonContents : SE_CheckBoxContents,
                                              opt, widget));
-        const label_spec lspec = getLabelSpec(isRadio ? QStringLiteral("RadioButton") : QStringLiteral("CheckBox"));
+        const label_spec lspec = getLabelSpec(isRadio ? RadioButtonClass : CheckBoxClass);
         if (opt->direction == Qt::RightToLeft)
           cr.adjust(lspec.right, 0 , -lspec.left, 0);
         else
@@ -14304,7 +14649,7 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
       if (qstyleoption_cast<const QStyleOptionViewItem*>(option))
       {
         if (option->state & State_Selected)
-          r = interiorRect(option->rect, getFrameSpec(QStringLiteral("ItemView")));
+          r = interiorRect(option->rect, getFrameSpec(ItemViewClass));
         else
           r = option->rect.adjusted(1,1,-1,-1);
       }
@@ -14321,10 +14666,11 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
     case SE_HeaderLabel : return option->rect;
 
     case SE_HeaderArrow : {
-      const QString group = "HeaderSection";
-      const frame_spec fspec = getFrameSpec(group);
-      const indicator_spec dspec = getIndicatorSpec(group);
-      const label_spec lspec = getLabelSpec(group);
+      const int group = HeaderSectionClass;
+      const widget_specs &specs = getWidgetSpecs(group);
+      const frame_spec &fspec = specs.fspec;
+      const indicator_spec &dspec = specs.dspec;
+      const label_spec &lspec = labelSpec(specs);
       if (const QStyleOptionHeader *opt = qstyleoption_cast<const QStyleOptionHeader*>(option))
       {
         if (opt->orientation != Qt::Horizontal)
@@ -14345,9 +14691,9 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
     case SE_ProgressBarGroove : return option->rect;
 
     case SE_LineEditContents : {
-      frame_spec fspec = getFrameSpec(QStringLiteral("LineEdit"));
-      label_spec lspec = getLabelSpec(QStringLiteral("LineEdit"));
-      size_spec sspec = getSizeSpec(QStringLiteral("LineEdit"));
+      frame_spec fspec = getFrameSpec(LineEditClass);
+      label_spec lspec = getLabelSpec(LineEditClass);
+      size_spec sspec = getSizeSpec(LineEditClass);
       /* when editing itemview texts, a thin frame is always drawn
          (see PE_PanelLineEdit) */
       if (qobject_cast<QAbstractItemView*>(getParent(widget,2)))
@@ -14414,7 +14760,7 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
                                         + (p->buttonSymbols() == QAbstractSpinBox::NoButtons ? fspec.right : 0)
               || (p->buttonSymbols() != QAbstractSpinBox::NoButtons
                   && p->width() < option->rect.width() + 2*tspec_.spin_button_width
-                                                       + getFrameSpec(QStringLiteral("IndicatorSpinBox")).right))
+                                                       + getFrameSpec(IndicatorSpinBoxClass).right))
           {
             fspec.left = qMin(fspec.left,3);
             fspec.right = qMin(fspec.right,3);
@@ -14459,7 +14805,7 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
           {
             rect.adjust(-fspec.left-lspec.left+3, 0, 0, 0);
             int arrowFrameSize = tspec_.combo_as_lineedit ? fspec.left
-                                                          : getFrameSpec(QStringLiteral("ComboBox")).left;
+                                                          : getFrameSpec(ComboBoxClass).left;
             if (widget->width() < cb->width()
                                   - (tspec_.square_combo_button
                                        ? qMax(COMBO_ARROW_LENGTH, cb->height()-arrowFrameSize)
@@ -14515,7 +14861,7 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
 
         Qt::Alignment align = opt->displayAlignment;
         QStyleOptionViewItem::Position pos = opt->decorationPosition;
-        const label_spec lspec = getLabelSpec(QStringLiteral("ItemView"));
+        const label_spec lspec = getLabelSpec(ItemViewClass);
 
         /* The right and left text margins are added in
            PM_FocusFrameHMargin, so there's no need to this.
@@ -14535,7 +14881,7 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
 
         /* also add the top and bottom frame widths
            because they aren't added in qcommonstyle.cpp */
-        const frame_spec fspec = getFrameSpec(QStringLiteral("ItemView"));
+        const frame_spec fspec = getFrameSpec(ItemViewClass);
         if (align & Qt::AlignTop)
         {
           if (!hasIcon || pos != QStyleOptionViewItem::Top)
@@ -14615,7 +14961,7 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
         if (vopt && (vopt->features & QStyleOptionViewItem::HasDecoration))
         {
           QStyleOptionViewItem::Position pos = opt->decorationPosition;
-          const frame_spec fspec = getFrameSpec(QStringLiteral("ItemView"));
+          const frame_spec fspec = getFrameSpec(ItemViewClass);
           if (pos == QStyleOptionViewItem::Left)
             r.adjust(fspec.left, 0, fspec.left, 0);
           else if (pos == QStyleOptionViewItem::Right)
@@ -14635,8 +14981,8 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
           qstyleoption_cast<const QStyleOptionButton*>(option);
       if (opt && !opt->text.isEmpty() && qobject_cast<const QAbstractItemView*>(widget))
       { // as in Kate's preferences for its default text style
-        const frame_spec fspec = getFrameSpec(QStringLiteral("PanelButtonCommand"));
-        const label_spec lspec = getLabelSpec(QStringLiteral("PanelButtonCommand"));
+        const frame_spec fspec = getFrameSpec(PanelButtonCommandClass);
+        const label_spec lspec = getLabelSpec(PanelButtonCommandClass);
         r.adjust(-fspec.left-lspec.left,
                  -fspec.top-lspec.top,
                  fspec.right+lspec.right,
@@ -14788,7 +15134,7 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
           if (!tw || !tw->documentMode())
           {
             docMode = false;
-            const frame_spec fspec = getFrameSpec(QStringLiteral("TabFrame"));
+            const frame_spec fspec = getFrameSpec(TabFrameClass);
             left = fspec.left + 1;
             top = fspec.top + 1;
             right = fspec.right + 1;
@@ -15076,8 +15422,8 @@ QRect Style::subElementRect(QStyle::SubElement element, const QStyleOption *opti
 
         bool atBottom = true;
         int offset = 0;
-        const frame_spec fspec = getFrameSpec(QStringLiteral("Tab"));
-        const label_spec lspec = getLabelSpec(QStringLiteral("Tab"));
+        const frame_spec fspec = getFrameSpec(TabClass);
+        const label_spec lspec = getLabelSpec(TabClass);
         switch (tab->shape) {
           case QTabBar::RoundedWest:
           case QTabBar::TriangularWest:
@@ -15181,7 +15527,7 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
         case SC_TitleBarSysMenu :
         case SC_TitleBarContextHelpButton : {
           // level the buttons with the title
-          const label_spec lspec = getLabelSpec(QStringLiteral("TitleBar"));
+          const label_spec lspec = getLabelSpec(TitleBarClass);
           int v = (lspec.top - lspec.bottom)/2;
           return QCommonStyle::subControlRect(control,option,subControl,widget).adjusted(0, v, 0, v);
         }
@@ -15193,9 +15539,9 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
     case CC_SpinBox : {
       int sw = tspec_.spin_button_width;
       const QAbstractSpinBox *sb = qobject_cast<const QAbstractSpinBox*>(widget);
-      frame_spec fspec = getFrameSpec(QStringLiteral("IndicatorSpinBox"));
-      frame_spec fspecLE = getFrameSpec(QStringLiteral("LineEdit"));
-      const size_spec sspecLE = getSizeSpec(QStringLiteral("LineEdit"));
+      frame_spec fspec = getFrameSpec(IndicatorSpinBoxClass);
+      frame_spec fspecLE = getFrameSpec(LineEditClass);
+      const size_spec sspecLE = getSizeSpec(LineEditClass);
       const QStyleOptionSpinBox *opt = qstyleoption_cast<const QStyleOptionSpinBox*>(option);
       // the measure we used in CC_SpinBox at drawComplexControl() (for QML)
       bool verticalIndicators(tspec_.vertical_spin_indicators || (!widget && opt && opt->frame));
@@ -15304,21 +15650,21 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
           frame_spec fspec;
           if (opt && opt->editable && (tspec_.combo_as_lineedit || tspec_.square_combo_button))
           {
-            fspec = getFrameSpec(QStringLiteral("LineEdit"));
+            fspec = getFrameSpec(LineEditClass);
             arrowFrameSize = tspec_.combo_as_lineedit
                                ? rtl ? fspec.left : fspec.right
-                               : rtl ? getFrameSpec(QStringLiteral("ComboBox")).left
-                                     : getFrameSpec(QStringLiteral("ComboBox")).right;
+                               : rtl ? getFrameSpec(ComboBoxClass).left
+                                     : getFrameSpec(ComboBoxClass).right;
           }
           else
           {
-            fspec = getFrameSpec(QStringLiteral("ComboBox"));
+            fspec = getFrameSpec(ComboBoxClass);
             arrowFrameSize = rtl ? fspec.left : fspec.right;
           }
-          const label_spec combolspec =  getLabelSpec(QStringLiteral("ComboBox"));
+          const label_spec combolspec =  getLabelSpec(ComboBoxClass);
           if (isLibreoffice_ && widget == nullptr)
           {
-            const frame_spec Fspec = getFrameSpec(QStringLiteral("LineEdit"));
+            const frame_spec Fspec = getFrameSpec(LineEditClass);
             margin = qMin(Fspec.left,3);
           }
           else
@@ -15347,9 +15693,9 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
               qstyleoption_cast<const QStyleOptionComboBox*>(option);
           frame_spec fspec;
           if (opt && opt->editable && tspec_.combo_as_lineedit)
-            fspec = getFrameSpec(QStringLiteral("LineEdit"));
+            fspec = getFrameSpec(LineEditClass);
           else
-            fspec = getFrameSpec(QStringLiteral("ComboBox"));
+            fspec = getFrameSpec(ComboBoxClass);
           int combo_arrow_length = tspec_.square_combo_button
                                     ? qMax(COMBO_ARROW_LENGTH, h-(rtl ? fspec.left : fspec.right))
                                     : COMBO_ARROW_LENGTH;
@@ -15370,8 +15716,8 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
           QRect r = option->rect;
           const QStyleOptionComboBox *opt =
               qstyleoption_cast<const QStyleOptionComboBox*>(option);
-          frame_spec fspec = getFrameSpec(QStringLiteral("MenuItem"));
-          const label_spec lspec = getLabelSpec(QStringLiteral("MenuItem"));
+          frame_spec fspec = getFrameSpec(MenuItemClass);
+          const label_spec lspec = getLabelSpec(MenuItemClass);
           int space = fspec.left+lspec.left + fspec.right+lspec.right
                       + (tspec_.hide_combo_checkboxes
                            ? 0 // assuming a maximum value forced by Qt
@@ -15404,7 +15750,7 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
             else hasIcon = true; // QML
           }
 
-          fspec = getFrameSpec(QStringLiteral("Menu"));
+          fspec = getFrameSpec(MenuClass);
           space += 2*qMax(qMax(fspec.top,fspec.bottom), qMax(fspec.left,fspec.right))
                    + (!tspec_.shadowless_popup && !noComposite_
                         ? 2*settings_->getCompositeSpec().menu_shadow_depth
@@ -15445,9 +15791,9 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
       // -> CT_MdiControls
       frame_spec fspec;
       if (tspec_.merge_menubar_with_toolbar)
-        fspec = getFrameSpec(QStringLiteral("Toolbar"));
+        fspec = getFrameSpec(ToolbarClass);
       else
-        fspec = getFrameSpec(QStringLiteral("MenuBar"));
+        fspec = getFrameSpec(MenuBarClass);
 
       int buttonWidth = (option->rect.width()
                          - (option->direction == Qt::RightToLeft ? fspec.left : fspec.right) - 1)
@@ -15709,15 +16055,16 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
               bool rtl(opt->direction == Qt::RightToLeft);
               if (tb->popupMode() == QToolButton::MenuButtonPopup)
               {
-                const QString group = "DropDownButton";
-                frame_spec fspec = getFrameSpec(group);
-                indicator_spec dspec = getIndicatorSpec(group);
+                const int group = DropDownButtonClass;
+                const widget_specs &specs = getWidgetSpecs(group);
+                frame_spec fspec = specs.fspec;
+                indicator_spec dspec = specs.dspec;
                 /* limit the arrow size */
                 dspec.size = qMin(dspec.size, h);
                 /* lack of space */
                 if (opt && opt->toolButtonStyle == Qt::ToolButtonIconOnly && !opt->icon.isNull())
                 {
-                  const frame_spec fspec1 = getFrameSpec(QStringLiteral("PanelButtonTool"));
+                  const frame_spec fspec1 = getFrameSpec(PanelButtonToolClass);
                   if (w < opt->iconSize.width()+fspec1.left
                           +(rtl ? fspec.left : fspec.right)+dspec.size+2*TOOL_BUTTON_ARROW_MARGIN)
                   {
@@ -15737,10 +16084,11 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
                         || */tb->popupMode() == QToolButton::DelayedPopup)
                        && (opt->features & QStyleOptionToolButton::HasMenu))
               {
-                const QString group = "PanelButtonTool";
-                frame_spec fspec = getFrameSpec(group);
-                indicator_spec dspec = getIndicatorSpec(group);
-                label_spec lspec = getLabelSpec(group);
+                const int group = PanelButtonToolClass;
+                const widget_specs &specs = getWidgetSpecs(group);
+                frame_spec fspec = specs.fspec;
+                indicator_spec dspec = specs.dspec;
+                label_spec lspec = labelSpec(specs);
                 // -> CE_ToolButtonLabel
                 if (qobject_cast<QAbstractItemView*>(getParent(widget,2)))
                 {
@@ -15793,15 +16141,16 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
               bool rtl(opt->direction == Qt::RightToLeft);
               if (tb->popupMode() == QToolButton::MenuButtonPopup)
               {
-                const QString group = "DropDownButton";
-                frame_spec fspec = getFrameSpec(group);
-                indicator_spec dspec = getIndicatorSpec(group);
+                const int group = DropDownButtonClass;
+                const widget_specs &specs = getWidgetSpecs(group);
+                frame_spec fspec = specs.fspec;
+                indicator_spec dspec = specs.dspec;
                 /* limit the arrow size */
                 dspec.size = qMin(dspec.size, h);
                 /* lack of space */
                 if (opt && opt->toolButtonStyle == Qt::ToolButtonIconOnly && !opt->icon.isNull())
                 {
-                  const frame_spec fspec1 = getFrameSpec(QStringLiteral("PanelButtonTool"));
+                  const frame_spec fspec1 = getFrameSpec(PanelButtonToolClass);
                   if (w < opt->iconSize.width()+fspec1.left
                           +(rtl ? fspec.left : fspec.right)+dspec.size+2*TOOL_BUTTON_ARROW_MARGIN)
                   {
@@ -15820,9 +16169,10 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
                         || */tb->popupMode() == QToolButton::DelayedPopup)
                        && (opt->features & QStyleOptionToolButton::HasMenu))
               {
-                const QString group = "PanelButtonTool";
-                frame_spec fspec = getFrameSpec(group);
-                indicator_spec dspec = getIndicatorSpec(group);
+                const int group = PanelButtonToolClass;
+                const widget_specs &specs = getWidgetSpecs(group);
+                frame_spec fspec = specs.fspec;
+                indicator_spec dspec = specs.dspec;
                 // -> CE_ToolButtonLabel
                 if (qobject_cast<QAbstractItemView*>(getParent(widget,2)))
                 {
@@ -15871,7 +16221,7 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
         default_frame_spec(fspec);
         size_spec sspec;
         default_size_spec(sspec);
-        label_spec lspec = getLabelSpec(QStringLiteral("GroupBox"));
+        label_spec lspec = getLabelSpec(GroupBoxClass);
 
         bool rtl(option->direction == Qt::RightToLeft);
         bool checkable = false;
@@ -15904,7 +16254,7 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
         int checkHeight = (checkable ? pixelMetric(PM_IndicatorHeight) : 0);
         /* because of a bug in Qt, the flat feature may not be set here when a flat groupbox is shown */
         //if (!(opt->features & QStyleOptionFrame::Flat))
-          fspec = getFrameSpec(QStringLiteral("GroupBox"));
+          fspec = getFrameSpec(GroupBoxClass);
         int labelMargin = (tspec_.groupbox_top_label ? 0 : (rtl ? fspec.right : fspec.left) + 10);
 
         switch (subControl) {
@@ -15930,7 +16280,7 @@ QRect Style::subControlRect(QStyle::ComplexControl control,
                          textSize.height());
           }
           case SC_GroupBoxContents : {
-            lspec = getLabelSpec(QStringLiteral("GroupBox")); // restore the label spec
+            lspec = getLabelSpec(GroupBoxClass); // restore the label spec
             int top = 0;
             if (!tspec_.groupbox_top_label)
               top = qMax(checkHeight,textSize.height())/2;
@@ -15976,10 +16326,19 @@ QPixmap Style::generatedIconPixmap(QIcon::Mode iconMode,
 {
   switch (iconMode) {
     case QIcon::Disabled: {
+      QColor bg = option->palette.color(QPalette::Disabled, QPalette::Window);
+
+      /* icons are generated repeatedly in item views */
+      icon_pixmap_key key;
+      key.pixmap = pixmap.cacheKey();
+      key.mode = iconMode;
+      key.color = bg.rgba();
+      if (QPixmap *cached = iconPixmaps_.object(key))
+        return *cached;
+
       QImage im = pixmap.toImage().convertToFormat(QImage::Format_ARGB32);
 
       // Create a colortable based on the background (black -> bg -> white)
-      QColor bg = option->palette.color(QPalette::Disabled, QPalette::Window);
       int red = bg.red();
       int green = bg.green();
       int blue = bg.blue();
@@ -16010,32 +16369,54 @@ QPixmap Style::generatedIconPixmap(QIcon::Mode iconMode,
       else if (intensity <= 128)
         intensity -= 51;
 
+      /* map the gray values directly to the colors, taking intensity
+         adjustment and a magic offset into account, so that there's
+         only one lookup per pixel */
+      QRgb grays[256];
+      for (int i=0; i<256; ++i)
+      {
+        uint ci = uint(i/3 + (130 - intensity / 3));
+        grays[i] = qRgb(reds[ci], greens[ci], blues[ci]);
+      }
+
+      const int w = im.width();
       for (int y=0; y<im.height(); ++y)
       {
         QRgb *scanLine = reinterpret_cast<QRgb*>(im.scanLine(y));
-        for (int x=0; x<im.width(); ++x)
+        for (int x=0; x<w; ++x)
         {
-          QRgb pixel = *scanLine;
-          // Calculate color table index, taking intensity adjustment
-          // and a magic offset into account.
-          uint ci = uint(qGray(pixel)/3 + (130 - intensity / 3));
-          *scanLine = qRgba(reds[ci], greens[ci], blues[ci], qAlpha(pixel));
-          ++scanLine;
+          const QRgb pixel = scanLine[x];
+          scanLine[x] = (grays[qGray(pixel)] & RGB_MASK) | (pixel & ~RGB_MASK);
         }
       }
 
-      return QPixmap::fromImage(im);
+      QPixmap res = QPixmap::fromImage(im);
+      iconPixmaps_.insert(key, new QPixmap(res),
+                          qMax(1, res.width()*res.height()*res.depth()/(8*1024)));
+      return res;
     }
     case QIcon::Selected: {
       if (hspec_.no_selection_tint) break;
-      QImage img = pixmap.toImage().convertToFormat(QImage::Format_ARGB32_Premultiplied);
       QColor color = option->palette.color(QPalette::Active, QPalette::Highlight);
       color.setAlphaF(0.2); // Qt sets it to 0.3
+
+      icon_pixmap_key key;
+      key.pixmap = pixmap.cacheKey();
+      key.mode = iconMode;
+      key.color = color.rgba();
+      if (QPixmap *cached = iconPixmaps_.object(key))
+        return *cached;
+
+      QImage img = pixmap.toImage().convertToFormat(QImage::Format_ARGB32_Premultiplied);
       QPainter painter(&img);
       painter.setCompositionMode(QPainter::CompositionMode_SourceAtop);
       painter.fillRect(0, 0, img.width(), img.height(), color);
       painter.end();
-      return QPixmap::fromImage(img);
+
+      QPixmap res = QPixmap::fromImage(img);
+      iconPixmaps_.insert(key, new QPixmap(res),
+                          qMax(1, res.width()*res.height()*res.depth()/(8*1024)));
+      return res;
     }
     case QIcon::Active:
       return pixmap;
@@ -16214,16 +16595,80 @@ bool Style::elementExists(const QString &elementName) const
   return false;
 }
 
-label_spec Style::getLabelSpec(const QString &widgetName) const
+/* Interned widget names (the index of the vector is the widget class ID) */
+static QHash<QString, int> widgetClassIds;
+static QVector<QString> widgetClassNames;
+
+/* Give the built-in class IDs (see Style::WidgetClass) to their widget names. */
+static void internBuiltinWidgetClasses()
 {
-  label_spec lspec = settings_->getLabelSpec(widgetName);
-  if (QApplication::layoutDirection() == Qt::RightToLeft)
+  if (!widgetClassNames.isEmpty())
+    return;
+  static const char *names[Style::BuiltinClassCount] = {
+    "PanelButtonCommand", "PanelButtonTool", "ToolbarButton", "DropDownButton",
+    "LineEdit", "ToolbarLineEdit", "ComboBox", "ToolbarComboBox",
+    "IndicatorSpinBox", "Toolbar", "MenuBar", "MenuBarItem", "Menu", "MenuItem",
+    "Tab", "TabFrame", "ItemView", "HeaderSection", "GroupBox", "RadioButton",
+    "CheckBox", "GenericFrame", "Progressbar", "ProgressbarContents",
+    "ScrollbarGroove", "ScrollbarSlider", "Slider", "SliderCursor", "Splitter",
+    "DockTitle", "TitleBar", "ToolTip", "Window"
+  };
+  for (int i = 0; i < Style::BuiltinClassCount; ++i)
   {
-    int l = lspec.left;
-    lspec.left = lspec.right;
-    lspec.right = l;
+    const QString name = QLatin1String(names[i]);
+    widgetClassNames.append(name);
+    widgetClassIds.insert(name, i);
   }
-  return lspec;
+}
+
+int Style::widgetClassId(const QString &widgetName)
+{
+  internBuiltinWidgetClasses();
+  QHash<QString, int>::const_iterator it = widgetClassIds.constFind(widgetName);
+  if (it != widgetClassIds.constEnd())
+    return it.value();
+  int id = widgetClassNames.size();
+  widgetClassNames.append(widgetName);
+  widgetClassIds.insert(widgetName, id);
+  return id;
+}
+
+const Style::widget_specs &Style::getWidgetSpecs(int classId) const
+{
+  if (classId < widgetSpecs_.size())
+  {
+    if (const widget_specs *cached = widgetSpecs_.at(classId).data())
+      return *cached;
+  }
+  else
+    widgetSpecs_.resize(classId + 1);
+
+  internBuiltinWidgetClasses();
+  const QString &widgetName = widgetClassNames.at(classId);
+  widget_specs *specs = new widget_specs;
+  specs->fspec = settings_->getFrameSpec(widgetName);
+  specs->ispec = settings_->getInteriorSpec(widgetName);
+  specs->dspec = settings_->getIndicatorSpec(widgetName);
+  /* elements are interned only once, not whenever they're drawn */
+  setSpecElement(specs->fspec, specs->fspec.element);
+  specs->fspec.expandedElementId = specs->fspec.expandedElement.isEmpty()
+                                     ? -1 : elementId(specs->fspec.expandedElement);
+  setSpecElement(specs->ispec, specs->ispec.element);
+  setSpecElement(specs->dspec, specs->dspec.element);
+  specs->lspec = settings_->getLabelSpec(widgetName);
+  /* the label spec is mirrored only once for RTL */
+  specs->rtlLspec = specs->lspec;
+  specs->rtlLspec.left = specs->lspec.right;
+  specs->rtlLspec.right = specs->lspec.left;
+  specs->sspec = settings_->getSizeSpec(widgetName);
+  /* the specs stay where they are when the vector grows */
+  widgetSpecs_[classId] = QSharedPointer<widget_specs>(specs);
+  return *specs;
+}
+
+const label_spec &Style::labelSpec(const widget_specs &specs)
+{
+  return QApplication::layoutDirection() == Qt::RightToLeft ? specs.rtlLspec : specs.lspec;
 }
 
 }
@@ -20,6 +20,10 @@
 
 #include <QCommonStyle>
 #include <QMap>
+#include <QVector>
+#include <QCache>
+#include <QSharedPointer>
+#include <QTransform>
 #include <QItemDelegate>
 #include <QAbstractItemView>
 #include <QToolButton>
@@ -29,10 +33,15 @@
 #include "themeconfig/ThemeConfig.h"
 #include "blur/blurhelper.h"
 #include "animation/animation.h"
+#include "animation/frameclock.h"
+#include "cache/rendercache.h"
+#include "cache/sharedatlas.h"
+#include "svg/lazysvgrenderer.h"
+#include "profiling/profiler.h"
 
 // definitions shared by source files
 #define SLIDER_TICK_SIZE 5 // 10 at most
-#define ANIMATION_FRAME 40 // in ms
+#define ANIMATION_FRAME 40 // in ms, the default frame interval and the duration of an opacity step
 
 class QSvgRenderer;
 
@@ -44,6 +53,85 @@ template <typename T> using KvPointer = QPointer<T>;
 template <typename T> using KvPointer = QWeakPointer<T>;
 #endif*/
 
+/* The key of a composited label shadow */
+typedef struct {
+  QFont font;
+  QString text;
+  int talign;
+  QSize size; // text rect size
+  QRgb color;
+  qreal opacity;
+  int depth, xshift, yshift;
+  qreal pixelRatio;
+  bool rtl; // layout direction of the painter
+} label_shadow_key;
+
+inline bool operator==(const label_shadow_key &k1, const label_shadow_key &k2)
+{
+  return k1.text == k2.text && k1.talign == k2.talign && k1.size == k2.size
+         && k1.color == k2.color && k1.opacity == k2.opacity
+         && k1.depth == k2.depth && k1.xshift == k2.xshift && k1.yshift == k2.yshift
+         && k1.pixelRatio == k2.pixelRatio && k1.rtl == k2.rtl
+         && k1.font == k2.font;
+}
+
+inline uint qHash(const label_shadow_key &key, uint seed = 0)
+{
+  return ::qHash(key.text, seed) ^ ::qHash(key.font) ^ ::qHash(key.color)
+         ^ ::qHash((key.size.width() << 16) | (key.size.height() & 0xffff))
+         ^ ::qHash((key.talign << 8) | (key.depth << 1) | (key.rtl ? 1 : 0));
+}
+
+/* The key of a generated icon pixmap */
+typedef struct {
+  qint64 pixmap; // the cache key of the source pixmap
+  int mode;
+  QRgb color; // the palette color used in generating the pixmap
+} icon_pixmap_key;
+
+inline bool operator==(const icon_pixmap_key &k1, const icon_pixmap_key &k2)
+{
+  return k1.pixmap == k2.pixmap && k1.mode == k2.mode && k1.color == k2.color;
+}
+
+inline uint qHash(const icon_pixmap_key &key, uint seed = 0)
+{
+  return ::qHash(key.pixmap, seed) ^ ::qHash(key.color) ^ ::qHash(key.mode);
+}
+
+/* The key of a rasterized state of an animated widget */
+typedef struct {
+  const QWidget *widget;
+  int frameElement, interiorElement; // interned IDs (-1 for no interior)
+  QSize size;
+  qreal pixelRatio;
+  bool grouped;
+  /* the frame spec fields that may be changed before drawing */
+  int top,bottom,left,right;
+  int expansion;
+  bool isAttached;
+  int HPos,VPos;
+} animation_frame_key;
+
+inline bool operator==(const animation_frame_key &k1, const animation_frame_key &k2)
+{
+  return k1.widget == k2.widget && k1.size == k2.size
+         && k1.pixelRatio == k2.pixelRatio && k1.grouped == k2.grouped
+         && k1.top == k2.top && k1.bottom == k2.bottom
+         && k1.left == k2.left && k1.right == k2.right
+         && k1.expansion == k2.expansion && k1.isAttached == k2.isAttached
+         && k1.HPos == k2.HPos && k1.VPos == k2.VPos
+         && k1.frameElement == k2.frameElement && k1.interiorElement == k2.interiorElement;
+}
+
+inline uint qHash(const animation_frame_key &key, uint seed = 0)
+{
+  return ::qHash(key.frameElement, seed) ^ ::qHash(key.interiorElement)
+         ^ ::qHash(reinterpret_cast<quintptr>(key.widget))
+         ^ ::qHash((key.size.width() << 16) | (key.size.height() & 0xffff))
+         ^ ::qHash(key.grouped ? 1 : 0);
+}
+
 // Used only to give appropriate top and bottom margins to
 // combo popup items (adapted from the Breeze style plugin).
 class KvComboItemDelegate : public QItemDelegate
@@ -173,8 +261,83 @@ class Style : public QCommonStyle {
     /* Use the default config. */
     void setBuiltinDefaultTheme();
 
+    /* Clear everything that is found in the config or SVG file of a theme. */
+    void clearThemeCaches();
+
     /* Set theme dependencies. */
     void setupThemeDeps();
+    /* Load the SVG image of the theme. */
+    void loadThemeSvg(const QString &svgFile);
+
+    /* The SVG element that is really drawn for a requested element name */
+    typedef struct {
+      /* has the element name been searched for? */
+      bool resolved;
+      /* the renderer containing the element (nullptr if it isn't found) */
+      QSvgRenderer *renderer;
+      /* the element name after falling back to the active or normal state */
+      QString element;
+      /* does a separate pattern element exist? */
+      bool hasPattern;
+    } svg_element;
+
+    /* Parts of a frame, in the order of their name suffixes (see renderFrame) */
+    enum FramePart {
+      FP_Top, FP_Bottom, FP_Left, FP_Right,
+      FP_TopLeft, FP_TopRight, FP_BottomLeft, FP_BottomRight,
+      FP_TopLeftJunct, FP_TopRightJunct, FP_BottomLeftJunct, FP_BottomRightJunct,
+      FP_LeftLeftJunct, FP_LeftRightJunct, FP_RightLeftJunct, FP_RightRightJunct,
+      FP_Center, // the element itself (the interior of an expanded frame)
+      FP_Count
+    };
+
+    /* Element IDs of all parts of a frame element */
+    typedef struct {
+      int part[FP_Count];
+    } frame_parts;
+
+    /* Everything about a frame element that doesn't depend on the frame size */
+    typedef struct {
+      /* the ID of the element, considering frame expansion */
+      int realElement;
+      /* do "expand-", "border-...-top" and "expand-...-top" elements exist? */
+      bool hasExpanded, hasBorder, hasExpandedTop;
+      /* parts of the element itself, the real element,
+         the "border-" element and the "expand-" element */
+      frame_parts element, real, border, expanded;
+    } frame_elements;
+
+    /* Intern an element name into a small integer ID. IDs are
+       valid until the theme is set again. */
+    int elementId(const QString &element) const;
+    /* Find the SVG element that should be drawn for the given ID
+       (only once), so that SVG renderers aren't searched repeatedly. */
+    svg_element resolveElement(int id) const;
+    /* Return the ID of an element with the name of a state appended to
+       it ("-toggled-inactive", etc.). Each element and state is looked
+       up only once (see stateElementIds_). */
+    int stateElementId(int id, int state) const;
+    /* Suffixes that are appended to interned elements while drawing */
+    enum ElementSuffix {
+      SeparatorSuffix, // "-separator"
+      IconSeparatorSuffix, // "-icon-separator"
+      TopSuffix, // "-top"
+      BottomSuffix, // "-bottom"
+      RightSuffix, // "-right"
+      SuffixCount
+    };
+    /* Return the ID of an element with a suffix appended to it.
+       Like stateElementId(), each name is created only once. */
+    int suffixElementId(int id, int suffix) const;
+    /* Intern a frame element with the expanded element of its
+       frame spec and compute the IDs of all its parts. */
+    int frameElementsId(int id, const frame_spec &fspec) const;
+    /* Set the element of a spec together with its interned ID,
+       so that the element isn't interned again when it's drawn. */
+    void setSpecElement(frame_spec &fspec, const QString &element) const;
+    void setSpecElement(interior_spec &ispec, const QString &element) const;
+    void setSpecElement(indicator_spec &dspec, const QString &element) const;
+    void internFrameParts(frame_parts &parts, const QString &element) const;
 
     /* Render the element from the SVG file into the given bounds. */
     bool renderElement(QPainter *painter,
@@ -182,7 +345,23 @@ class Style : public QCommonStyle {
                        const QRect &bounds,
                        int hsize = 0, int vsize = 0, // pattern sizes
                        bool usePixmap = false // first make a QPixmap for drawing
-                      ) const;
+                      ) const {
+      if (element.isEmpty()) return true;
+      return renderElement(painter,elementId(element),bounds,hsize,vsize,usePixmap);
+    }
+    bool renderElement(QPainter *painter,
+                       int id, // interned element ID
+                       const QRect &bounds,
+                       int hsize = 0, int vsize = 0,
+                       bool usePixmap = false) const;
+    /* Render a part of a frame (see renderFrame). Unpatterned parts
+       are rasterized only once per size and pixel ratio and then
+       drawn from the render cache. */
+    void renderFramePart(QPainter *painter,
+                         int id,
+                         const QRect &bounds,
+                         int hsize, int vsize,
+                         bool usePixmap) const;
     /* Render the (vertical) slider ticks. */
     void renderSliderTick(QPainter *painter,
                           const QString &element,
@@ -194,32 +373,145 @@ class Style : public QCommonStyle {
                           bool above, // left
                           bool inverted) const;
 
-    /* Return the state of the given widget. */
-    QString getState(const QStyleOption *option, const QWidget *widget) const;
+    /* Widget states as a compact bitmask: one of the base states,
+       possibly combined with the inactive flag. */
+    enum WidgetState {
+      NormalState = 0,
+      FocusedState,
+      PressedState,
+      ToggledState,
+      DisabledState,
+      BaseStateMask = 0x7,
+      InactiveState = 0x8,
+      /* only used by state change animations, to distinguish
+         a toggled combo box from a toggled button */
+      ComboState = 0x10,
+      NoState = -1 // the element name already has its state (if any)
+    };
+    static int baseState(int state) {
+      return state & BaseStateMask;
+    }
+    static bool isInactiveState(int state) {
+      return state & InactiveState;
+    }
+    /* The number of distinct states, for indexing tables by state */
+    static const int stateCount = 2*(DisabledState+1);
+    static int stateIndex(int state) {
+      int base = qMin(baseState(state), static_cast<int>(DisabledState));
+      return isInactiveState(state) ? base + DisabledState + 1 : base;
+    }
+    /* Return the state of the given widget as a bitmask. */
+    int getWidgetState(const QStyleOption *option, const QWidget *widget) const;
+    /* Return the name of a state, as used in SVG element names
+       ("toggled-inactive", etc.). The names are created only once. */
+    static const QString &stateName(int state);
+    /* Return the state from which the state change animation of a
+       widget starts, as kept by its style object (or NoState). */
+    static int animationStartStateOf(const QObject *styleObject);
+    /* Return the state of the given widget by name. */
+    QString getState(const QStyleOption *option, const QWidget *widget) const {
+      return stateName(getWidgetState(option,widget));
+    }
+    /* All specs of a widget, resolved only once per theme */
+    typedef struct {
+      frame_spec fspec;
+      interior_spec ispec;
+      indicator_spec dspec;
+      label_spec lspec;
+      label_spec rtlLspec; // with swapped left and right margins
+      size_spec sspec;
+    } widget_specs;
+    /* Fixed class IDs of the widgets that are drawn most often, so that
+       their specs are found without hashing their names. The order is
+       that of the names in widgetClassId(). */
+    enum WidgetClass {
+      PanelButtonCommandClass = 0,
+      PanelButtonToolClass,
+      ToolbarButtonClass,
+      DropDownButtonClass,
+      LineEditClass,
+      ToolbarLineEditClass,
+      ComboBoxClass,
+      ToolbarComboBoxClass,
+      IndicatorSpinBoxClass,
+      ToolbarClass,
+      MenuBarClass,
+      MenuBarItemClass,
+      MenuClass,
+      MenuItemClass,
+      TabClass,
+      TabFrameClass,
+      ItemViewClass,
+      HeaderSectionClass,
+      GroupBoxClass,
+      RadioButtonClass,
+      CheckBoxClass,
+      GenericFrameClass,
+      ProgressbarClass,
+      ProgressbarContentsClass,
+      ScrollbarGrooveClass,
+      ScrollbarSliderClass,
+      SliderClass,
+      SliderCursorClass,
+      SplitterClass,
+      DockTitleClass,
+      TitleBarClass,
+      ToolTipClass,
+      WindowClass,
+      BuiltinClassCount
+    };
+    /* Intern a widget name of the theme config file (like "PanelButtonCommand")
+       into a small integer ID. IDs don't depend on the theme. */
+    static int widgetClassId(const QString &widgetName);
+    /* Return all specs of the given widget from the theme config file. */
+    const widget_specs &getWidgetSpecs(int classId) const;
+    const widget_specs &getWidgetSpecs(const QString &widgetName) const {
+      return getWidgetSpecs(widgetClassId(widgetName));
+    }
     /* Return the frame spec of the given widget from the theme config file. */
+    frame_spec getFrameSpec(int classId) const {
+      return getWidgetSpecs(classId).fspec;
+    }
     frame_spec getFrameSpec(const QString &widgetName) const {
-      return settings_->getFrameSpec(widgetName);
+      return getWidgetSpecs(widgetName).fspec;
     }
     /* Return the interior spec of the given widget from the theme config file. */
+    interior_spec getInteriorSpec(int classId) const {
+      return getWidgetSpecs(classId).ispec;
+    }
     interior_spec getInteriorSpec(const QString &widgetName) const {
-      return settings_->getInteriorSpec(widgetName);
+      return getWidgetSpecs(widgetName).ispec;
     }
     /* Return the indicator spec of the given widget from the theme config file. */
+    indicator_spec getIndicatorSpec(int classId) const {
+      return getWidgetSpecs(classId).dspec;
+    }
     indicator_spec getIndicatorSpec(const QString &widgetName) const {
-      return settings_->getIndicatorSpec(widgetName);
+      return getWidgetSpecs(widgetName).dspec;
     }
     /* Return the label (text+icon) spec of the given widget from the theme config file. */
-    label_spec getLabelSpec(const QString &widgetName) const;
+    label_spec getLabelSpec(int classId) const {
+      return labelSpec(getWidgetSpecs(classId));
+    }
+    label_spec getLabelSpec(const QString &widgetName) const {
+      return labelSpec(getWidgetSpecs(widgetName));
+    }
+    /* Return the label spec of a spec bundle for the layout direction of the app. */
+    static const label_spec &labelSpec(const widget_specs &specs);
     /* Return the size spec of the given widget from the theme config file */
+    size_spec getSizeSpec(int classId) const {
+      return getWidgetSpecs(classId).sspec;
+    }
     size_spec getSizeSpec(const QString &widgetName) const {
-      return settings_->getSizeSpec(widgetName);
+      return getWidgetSpecs(widgetName).sspec;
     }
 
     /* Generic method that draws a frame. */
     void renderFrame(QPainter *painter,
                      const QRect &bounds, // frame bounds
                      frame_spec fspec, // frame spec
-                     const QString &element, // frame SVG element (basename)
+                     int element, // interned frame SVG element (basename)
+                     int state, // widget state to append to the element (or NoState)
                      int d = 0, // distance of the attached tab from the edge
                      int l = 0, // length of the attached tab
                      int f1 = 0, // width of tab's left frame
@@ -229,26 +521,72 @@ class Style : public QCommonStyle {
                      bool usePixmap = false, // first make a QPixmap for drawing
                      bool drawBorder = true // draw a border with maximum rounding if possible
                     ) const;
+    void renderFrame(QPainter *painter,
+                     const QRect &bounds,
+                     const frame_spec &fspec,
+                     const QString &element, // frame SVG element with its state
+                     int d = 0, int l = 0, int f1 = 0, int f2 = 0, int tp = 0,
+                     bool grouped = false,
+                     bool usePixmap = false,
+                     bool drawBorder = true) const {
+      renderFrame(painter,bounds,fspec,elementId(element),NoState,
+                  d,l,f1,f2,tp,grouped,usePixmap,drawBorder);
+    }
+
+    /* Draw the frame and interior of a widget in a state of its state
+       change animation. They're rasterized only once per animation,
+       so that the intermediate frames only blend two pixmaps. */
+    void renderAnimatedPanel(QPainter *painter,
+                             const QWidget *widget,
+                             const QRect &bounds,
+                             const frame_spec &fspec,
+                             const interior_spec &ispec,
+                             int state,
+                             bool drawInterior = true,
+                             bool grouped = false) const;
 
     /* Generic method that draws an interior. */
     bool renderInterior(QPainter *painter,
                         const QRect &bounds, // frame bounds
                         const frame_spec &fspec, // frame spec
                         const interior_spec &ispec, // interior spec
-                        const QString &element, // interior SVG element
+                        int element, // interned interior SVG element (basename)
+                        int state, // widget state to append to the element (or NoState)
                         bool grouped = false, // is among grouped similar widgets?
                         bool usePixmap = false // first make a QPixmap for drawing
                        ) const;
+    bool renderInterior(QPainter *painter,
+                        const QRect &bounds,
+                        const frame_spec &fspec,
+                        const interior_spec &ispec,
+                        const QString &element, // interior SVG element with its state
+                        bool grouped = false,
+                        bool usePixmap = false) const {
+      return renderInterior(painter,bounds,fspec,ispec,elementId(element),NoState,
+                            grouped,usePixmap);
+    }
 
     /* Generic method that draws an indicator. */
     bool renderIndicator(QPainter *painter,
                          const QRect &bounds, // frame bounds
                          const frame_spec &fspec, // frame spec
                          const indicator_spec &dspec, // indicator spec
-                         const QString &element, // indicator SVG element
+                         int element, // interned indicator SVG element (basename)
+                         int state, // widget state to append to the element (or NoState)
                          Qt::LayoutDirection ld = Qt::LeftToRight,
                          Qt::Alignment alignment = Qt::AlignCenter,
                          int vOffset = 0) const;
+    bool renderIndicator(QPainter *painter,
+                         const QRect &bounds,
+                         const frame_spec &fspec,
+                         const indicator_spec &dspec,
+                         const QString &element, // indicator SVG element with its state
+                         Qt::LayoutDirection ld = Qt::LeftToRight,
+                         Qt::Alignment alignment = Qt::AlignCenter,
+                         int vOffset = 0) const {
+      return renderIndicator(painter,bounds,fspec,dspec,elementId(element),NoState,
+                             ld,alignment,vOffset);
+    }
 
     /* Generic method that draws a label (text and/or icon) inside the frame. */
     void renderLabel(
@@ -267,6 +605,15 @@ class Style : public QCommonStyle {
                      const Qt::ToolButtonStyle tialign = Qt::ToolButtonTextBesideIcon, // relative positions of text and icon
                      bool centerLoneIcon = true // centered icon with empty text?
                     ) const;
+    /* Draw the shadow of a label text from a cached pixmap, in which all
+       shadow passes are composited only once (used by renderLabel). */
+    void drawLabelShadow(QPainter *painter,
+                         const QRect &rtext,
+                         int talign,
+                         const QString &text,
+                         const QColor &shadowColor,
+                         qreal opacity,
+                         const label_spec &lspec) const;
 
     /* Draws a focus rectangle. */
     void drawFocusRect(QPainter *painter, const QRect &rect, const QString &element) const;
@@ -294,6 +641,41 @@ class Style : public QCommonStyle {
 
     /* Draws background of translucent top widgets. */
     void drawBg(QPainter *p, const QWidget *widget) const;
+    /* The background specs of a translucent window and its last paint
+       (the rendered background is kept in the render cache) */
+    typedef struct {
+      interior_spec ispec;
+      size_spec sspec;
+      /* the window size and state when the background was last painted */
+      QSize size;
+      bool isInactive;
+      bool painted;
+      /* false if there was no interior to render in the last paint */
+      bool rendered;
+    } window_bg;
+    /* The geometry of the indicator of a busy progress bar */
+    typedef struct {
+      QTransform transform; // from the painter coordinates to the widget ones
+      QRect track; // the rectangle in which the indicator moves
+      int width;
+      bool inverted;
+    } busy_indicator;
+    /* Whether a toolbar contains a tab bar (see isStylableToolbar) */
+    typedef struct {
+      QPointer<const QWidget> toolbar; // null if the toolbar is destroyed
+      bool hasTabBar;
+    } tabbed_toolbar;
+    /* The neighbors of a grouped tool button and its kind (see whichGroupedTBtn) */
+    typedef struct {
+      QPointer<QToolButton> left; // null if it isn't beside the button
+      QPointer<QToolButton> right; // null if it isn't grouped with the button
+      int kind;
+    } grouped_tbtn;
+    /* The grouped tool buttons of a toolbar, found once per toolbar layout */
+    typedef struct {
+      QPointer<const QWidget> toolbar; // null if the toolbar is destroyed
+      QHash<const QWidget*, grouped_tbtn> buttons;
+    } toolbar_layout;
 
     /* Generic method to compute the ideal size of a widget. */
     QSize sizeCalculated(const QFont &font, // font to determine width/height
@@ -325,6 +707,13 @@ class Style : public QCommonStyle {
 
     /* Get menu margins, including its shadow. */
     int getMenuMargin(bool horiz) const;
+    /* Does the pixel metric depend only on the theme (and not
+       on the option or widget)? Such metrics are cached. */
+    static bool isThemeMetric(QStyle::PixelMetric metric);
+    /* Compute the pixel metric (see pixelMetric). */
+    int computePixelMetric(QStyle::PixelMetric metric,
+                           const QStyleOption *option,
+                           const QWidget *widget) const;
     /* Get pure shadow dimensions of menus/tooltips. */
     QList<qreal> getShadow(const QString &widgetName, int thicknessH, int thicknessV);
     QList<qreal> getShadow(const QString &widgetName, int thickness) {
@@ -335,6 +724,8 @@ class Style : public QCommonStyle {
     int mergedToolbarHeight(const QWidget *menubar) const;
     /* Is this a toolbar that should be styled? */
     bool isStylableToolbar(const QWidget *w, bool allowInvisible = false) const;
+    /* Does this toolbar contain a tab bar? */
+    bool toolbarHasTabBar(const QWidget *toolbar) const;
     /* Get the stylable toolbar containing this widget. */
     QWidget* getStylableToolbarContainer(const QWidget *w, bool allowInvisible = false) const;
     /* Does a widget without interior SVG element have
@@ -364,9 +755,6 @@ class Style : public QCommonStyle {
     /* Opacifies a translucent color if opaciry is forced. */
     void opacifyColor(QColor& col) const;
 
-    /* Gets color from #rrggbbaa. */
-    QColor getFromRGBA(const QString &str) const;
-
     /* Is the window of this widget inactive? */
     bool isWidgetInactive(const QWidget *widget) const;
 
@@ -384,6 +772,8 @@ class Style : public QCommonStyle {
 
     /* Find the kind of this tool-button among a group of tool-buttons (on a toolbar). */
     int whichGroupedTBtn(const QToolButton *tb, const QWidget *parentBar, bool &drawSeparator) const;
+    /* Find the neighbors of this tool-button (see whichGroupedTBtn). */
+    grouped_tbtn groupedTBtn(const QToolButton *tb, const QWidget *parentBar) const;
 
     /* The extra combo box width needed by frames and spacings. */
     int extraComboWidth(const QStyleOptionComboBox *opt, bool hasIcon) const;
@@ -405,21 +795,32 @@ class Style : public QCommonStyle {
     void removeAnimation(QObject *animation); // For transient scrollbars
 
   private:
-    QSvgRenderer *defaultRndr_, *themeRndr_;
+    LazySvgRenderer *defaultRndr_, *themeRndr_;
     ThemeConfig *defaultSettings_, *themeSettings_, *settings_;
 
     QString xdg_config_home;
 
-    QTimer *progressTimer_, *opacityTimer_, *opacityTimerOut_;
+    /* All animation timers are driven by the same frame clock */
+    FrameClock *frameClock_;
+    FrameTimer *progressTimer_, *opacityTimer_, *opacityTimerOut_;
+    int progressTime_; // the time (in ms) by which busy progress bars aren't advanced yet
     mutable int animationOpacity_, animationOpacityOut_; // A value >= 100 stops state change animation.
     /* The start state for state change animation */
-    mutable QString animationStartState_, animationStartStateOut_;
+    mutable int animationStartState_, animationStartStateOut_;
     /* The widget whose state change is animated */
     QPointer<QWidget> animatedWidget_, animatedWidgetOut_;
     QHash<QWidget*, QPointer<QWidget>> popupOrigins_;
 
     /* List of busy progress bars */
     QMap<QWidget*,int> progressbars_;
+    /* Where the indicators of busy progress bars were drawn (see advanceProgressbar) */
+    mutable QHash<const QWidget*, busy_indicator> busyIndicators_;
+    /* Toolbars that are checked for tab bars, forgotten when a child
+       is added to or removed from them (see toolbarHasTabBar) */
+    mutable QHash<const QWidget*, tabbed_toolbar> tabbedToolbars_;
+    /* Grouped tool buttons of toolbars, forgotten when
+       a toolbar is laid out again (see whichGroupedTBtn) */
+    mutable QHash<const QWidget*, toolbar_layout> toolbarLayouts_;
     /* List of windows, tooltips and menus that are (made) translucent */
     QSet<const QWidget*> translucentWidgets_;
     mutable QSet<QWidget*> forcedTranslucency_;
@@ -452,6 +853,9 @@ class Style : public QCommonStyle {
     /* The size of the slider handle with no tick mark (if it exists) */
     mutable int ticklessSliderHandleSize_;
 
+    /* Pixel metrics that depend only on the theme (see isThemeMetric) */
+    mutable QHash<int, int> themeMetrics_;
+
     /* For identifying KisSliderSpinBox */
     bool isKisSlider_;
 
@@ -488,11 +892,49 @@ class Style : public QCommonStyle {
        (for preventing redundant computations): */
     mutable QHash<const QWidget*, QList<int>> drawnMenus_;
 
+    /* Backgrounds of translucent windows (see drawBg) */
+    mutable QHash<const QWidget*, window_bg> windowBgs_;
+
     // For not searching the SVG file too often:
     mutable QHash<const QString, bool>expandedBorders_;
     mutable QHash<const QString, bool>flatArrows_;
     mutable QHash<const QString, bool>elements_;
 
+    /* Interned elements (the index of a vector is the element ID) */
+    mutable QHash<const QString, int> elementIds_;
+    mutable QVector<QString> elementNames_;
+    mutable QVector<svg_element> resolvedElements_;
+    /* IDs of elements with states appended to them, indexed by
+       element ID * stateCount + state index (-1 if not interned yet) */
+    mutable QVector<int> stateElementIds_;
+    /* IDs of elements with suffixes appended to them, indexed by
+       element ID * SuffixCount + suffix (-1 if not interned yet) */
+    mutable QVector<int> suffixElementIds_;
+    /* Interned frame elements, keyed by the IDs of the element and expanded element */
+    mutable QHash<QPair<int,int>, int> frameElementIds_;
+    mutable QVector<frame_elements> frameElements_;
+    /* Whether an "expand-" element exists for an interior element (keyed by
+       the element ID, and the IDs of interior and frame elements of the specs) */
+    mutable QHash<QPair<int,QPair<int,int>>, bool> expandedInteriors_;
+    /* Resolved specs of widgets (the index of the vector is the widget class ID).
+       They're allocated separately because references to them are returned. */
+    mutable QVector<QSharedPointer<widget_specs> > widgetSpecs_;
+    /* Rasterized frame parts and pattern tiles */
+    mutable RenderCache renderCache_;
+    /* Composited shadows of label texts */
+    mutable QCache<label_shadow_key, QPixmap> labelShadows_;
+    /* Pure shadow dimensions, keyed by the widget name and
+       the horizontal and vertical thicknesses (see getShadow) */
+    QHash<QPair<QString,QPair<int,int>>, QList<qreal>> shadows_;
+    /* The start and end states of the current state change animation */
+    mutable QCache<animation_frame_key, QPixmap> animationFrames_;
+    /* Disabled and selected icon pixmaps (see generatedIconPixmap) */
+    mutable QCache<icon_pixmap_key, QPixmap> iconPixmaps_;
+    /* Frame parts shared between processes (optional) */
+    SharedAtlas *sharedAtlas_;
+    /* The SVG image of the theme (empty if there's none) */
+    QString themeSvg_;
+
     mutable QHash<const QObject*, Animation*> animations_; // For transient scrollbars
 };
 }
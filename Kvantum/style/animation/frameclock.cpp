@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "frameclock.h"
+
+namespace Kvantum {
+
+FrameTimer::FrameTimer(FrameClock *clock, QObject *parent) : QObject(parent),
+    clock_(clock),
+    interval_(0),
+    due_(0),
+    last_(0),
+    elapsed_(0),
+    active_(false)
+{
+}
+
+FrameTimer::~FrameTimer()
+{
+  stop();
+}
+
+void FrameTimer::start(int interval)
+{
+  interval_ = qMax(interval, 0);
+  last_ = clock_->clock_.elapsed();
+  elapsed_ = 0;
+  due_ = last_ + interval_;
+  if (!active_)
+  {
+    active_ = true;
+    clock_->activate(this);
+  }
+}
+
+void FrameTimer::start()
+{
+  start(clock_->frameInterval());
+}
+
+void FrameTimer::stop()
+{
+  if (active_)
+  {
+    active_ = false;
+    clock_->deactivate(this);
+  }
+}
+
+/*************************/
+
+FrameClock::FrameClock(int fps, QObject *parent) : QObject(parent),
+    fps_(qBound(10, fps, 120))
+{
+  timer_.setInterval(1000 / fps_);
+  connect(&timer_, &QTimer::timeout, this, &FrameClock::tick);
+  clock_.start();
+}
+
+void FrameClock::setFrameRate(int fps)
+{
+  fps_ = qBound(10, fps, 120);
+  timer_.setInterval(1000 / fps_);
+}
+
+void FrameClock::activate(FrameTimer *timer)
+{
+  if (!active_.contains(timer))
+    active_.append(timer);
+  if (!timer_.isActive())
+    timer_.start();
+}
+
+void FrameClock::deactivate(FrameTimer *timer)
+{
+  active_.removeOne(timer);
+  /* don't wake up the process when nothing is animated */
+  if (active_.isEmpty())
+    timer_.stop();
+}
+
+void FrameClock::tick()
+{
+  const qint64 now = clock_.elapsed();
+  const qint64 halfFrame = 500 / fps_;
+  /* timers may be started or stopped by timeouts */
+  const QList<FrameTimer*> timers = active_;
+  for (FrameTimer *timer : timers)
+  {
+    if (!active_.contains(timer))
+      continue;
+    /* a timeout is due at the frame that is nearest to its time */
+    if (now + halfFrame >= timer->due_)
+    {
+      /* keep the cadence of the timer if it isn't lagging behind */
+      timer->due_ += timer->interval_;
+      if (timer->due_ + halfFrame <= now)
+        timer->due_ = now + timer->interval_;
+      timer->elapsed_ = static_cast<int>(now - timer->last_);
+      timer->last_ = now;
+      Q_EMIT timer->timeout();
+    }
+  }
+}
+
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FRAMECLOCK_H
+#define FRAMECLOCK_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QList>
+
+namespace Kvantum {
+
+class FrameClock;
+
+/* A timer with the API of QTimer that doesn't have its own timer
+   but is driven by a frame clock, so that all animations of the
+   style are updated in the same ticks. */
+class FrameTimer : public QObject
+{
+  Q_OBJECT
+
+public:
+  FrameTimer(FrameClock *clock, QObject *parent = nullptr);
+  ~FrameTimer();
+
+  void start(int interval);
+  /* Times out at every frame of the clock. */
+  void start();
+  void stop();
+  bool isActive() const {
+    return active_;
+  }
+  int interval() const {
+    return interval_;
+  }
+  /* The time (in ms) since the previous timeout or the start of the
+     timer, by which animations can be advanced independently of the
+     frame rate. It's valid when the timer times out. */
+  int elapsed() const {
+    return elapsed_;
+  }
+
+Q_SIGNALS:
+  void timeout();
+
+private:
+  friend class FrameClock;
+
+  FrameClock *clock_;
+  int interval_;
+  qint64 due_; // the time of the next timeout (see FrameClock::tick)
+  qint64 last_; // the time of the previous timeout or the start
+  int elapsed_;
+  bool active_;
+};
+
+/* The only timer of the style's animations. It ticks with
+   a fixed frame rate and only while a frame timer is active. */
+class FrameClock : public QObject
+{
+  Q_OBJECT
+
+public:
+  FrameClock(int fps, QObject *parent = nullptr);
+
+  int frameRate() const {
+    return fps_;
+  }
+  int frameInterval() const {
+    return 1000 / fps_;
+  }
+  void setFrameRate(int fps);
+
+private Q_SLOTS:
+  void tick();
+
+private:
+  friend class FrameTimer;
+
+  void activate(FrameTimer *timer);
+  void deactivate(FrameTimer *timer);
+
+  int fps_;
+  QTimer timer_;
+  QElapsedTimer clock_;
+  QList<FrameTimer*> active_;
+};
+
+}
+
+#endif // FRAMECLOCK_H
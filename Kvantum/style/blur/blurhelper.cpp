@@ -71,6 +71,8 @@ void BlurHelper::registerWidget (QWidget* widget)
       && !widget->windowFlags().testFlag(Qt::FramelessWindowHint))*/
 
     widget->installEventFilter (this);
+    connect (widget, &QObject::destroyed, this, &BlurHelper::widgetDestroyed,
+             Qt::UniqueConnection);
 }
 /*************************/
 void BlurHelper::unregisterWidget (QWidget* widget)
@@ -78,16 +80,23 @@ void BlurHelper::unregisterWidget (QWidget* widget)
   if (widget)
   {
     widget->removeEventFilter (this);
+    disconnect (widget, &QObject::destroyed, this, &BlurHelper::widgetDestroyed);
     clear (widget);
   }
 }
 /*************************/
+void BlurHelper::widgetDestroyed (QObject* object)
+{
+  /* the window is gone with its properties */
+  sentRegions_.remove (static_cast<QWidget*>(object));
+}
+/*************************/
 bool BlurHelper::eventFilter (QObject* object, QEvent* event)
 {
   switch (event->type())
   {
+    /* nothing is done on hiding (see update()) */
     case QEvent::Show:
-    case QEvent::Hide:
     case QEvent::Resize:
     /* the theme may change from
        Kvantum and to it again */
@@ -162,75 +171,117 @@ QRegion BlurHelper::blurRegion (QWidget* widget) const
             : wMask); // is the same as rect (see above)
 }
 /*************************/
-void BlurHelper::update (QWidget* widget) const
+void BlurHelper::update (void)
+{
+  bool changed = false;
+  for (const WidgetPointer& widget : static_cast<const WidgetSet&>(pendingWidgets_))
+  {
+    if (widget && update (widget.data()))
+      changed = true;
+  }
+  pendingWidgets_.clear();
+#if (QT_VERSION < QT_VERSION_CHECK(5,11,0)) && (defined Q_WS_X11 || defined Q_OS_LINUX)
+  /* with X11, send the property changes of all windows at once */
+  if (changed)
+    XFlush (QX11Info::display());
+#else
+  Q_UNUSED (changed);
+#endif
+}
+/*************************/
+bool BlurHelper::update (QWidget* widget)
 {
   if (!(widget->testAttribute (Qt::WA_WState_Created) || widget->internalWinId()))
-    return;
+    return false;
+  /* the region of a hidden window is kept, so that it
+     isn't set again when the window is shown (as with menus) */
+  if (!widget->isVisible())
+    return false;
 
+  bool changed = false;
   const QRegion region (blurRegion (widget));
   if (region.isEmpty())
-    clear (widget);
-#if (QT_VERSION >= QT_VERSION_CHECK(5,11,0))
+    changed = clear (widget);
   else
   {
-    KWindowEffects::enableBlurBehind (widget->internalWinId(), true, region);
-    /*NOTE: The contrast effect isn't used with menus and tooltips
-            because their borders may be anti-aliased. */
-    if ((contrast_ != static_cast<qreal>(1)
-         || intensity_ != static_cast<qreal>(1)
-         || saturation_ != static_cast<qreal>(1))
-        && !qobject_cast<QMenu*>(widget)
-        && !widget->inherits("QTipLabel")
-        && ((widget->windowFlags() & Qt::WindowType_Mask) != Qt::ToolTip
-            && !qobject_cast<QFrame*>(widget)))
+    /* don't set the same region again */
+    const WId id = widget->internalWinId();
+    QHash<const QWidget*, blur_region>::const_iterator it = sentRegions_.constFind (widget);
+    if (it == sentRegions_.constEnd()
+        || it.value().winId != id || it.value().region != region)
     {
-      KWindowEffects::enableBackgroundContrast (widget->internalWinId(), true,
-                                                contrast_, intensity_, saturation_,
-                                                region);
-    }
-  }
+#if (QT_VERSION >= QT_VERSION_CHECK(5,11,0))
+      KWindowEffects::enableBlurBehind (id, true, region);
+      /*NOTE: The contrast effect isn't used with menus and tooltips
+              because their borders may be anti-aliased. */
+      if ((contrast_ != static_cast<qreal>(1)
+           || intensity_ != static_cast<qreal>(1)
+           || saturation_ != static_cast<qreal>(1))
+          && !qobject_cast<QMenu*>(widget)
+          && !widget->inherits("QTipLabel")
+          && ((widget->windowFlags() & Qt::WindowType_Mask) != Qt::ToolTip
+              && !qobject_cast<QFrame*>(widget)))
+      {
+        KWindowEffects::enableBackgroundContrast (id, true,
+                                                  contrast_, intensity_, saturation_,
+                                                  region);
+      }
 #elif defined Q_WS_X11 || defined Q_OS_LINUX
-  else
-  {
-    QVector<unsigned long> data;
-    const QVector<QRect> allRects = region.rects();
-    for (const QRect& rect : allRects)
-    {
-      data << rect.x() << rect.y() << rect.width() << rect.height();
+      QVector<unsigned long> data;
+      const QVector<QRect> allRects = region.rects();
+      for (const QRect& rect : allRects)
+      {
+        data << rect.x() << rect.y() << rect.width() << rect.height();
+      }
+      XChangeProperty (QX11Info::display(), id,
+                       atom_blur_, XA_CARDINAL, 32, PropModeReplace,
+                       reinterpret_cast<const unsigned char *>(data.constData()),
+                       data.size());
+#endif
+      blur_region sent;
+      sent.winId = id;
+      sent.region = region;
+      sentRegions_.insert (widget, sent);
+      changed = true;
     }
-    XChangeProperty (QX11Info::display(), widget->internalWinId(),
-                     atom_blur_, XA_CARDINAL, 32, PropModeReplace,
-                     reinterpret_cast<const unsigned char *>(data.constData()),
-                     data.size());
   }
-#endif
   // force update
-  if (widget->isVisible())
+  if (changed)
     widget->update();
+  return changed;
 }
 /*************************/
-void BlurHelper::clear (QWidget* widget) const
+bool BlurHelper::clear (QWidget* widget)
 {
+  /* nothing to clear if no region is set */
+  QHash<const QWidget*, blur_region>::iterator it = sentRegions_.find (widget);
+  if (it == sentRegions_.end())
+    return false;
+  const WId id = it.value().winId;
+  sentRegions_.erase (it);
+
   // WARNING never use winId()
-  if (widget->internalWinId())
+  /* if the native window is recreated, its properties are gone */
+  if (!widget->internalWinId() || widget->internalWinId() != id)
+    return false;
 #if (QT_VERSION >= QT_VERSION_CHECK(5,11,0))
+  KWindowEffects::enableBlurBehind (id, false);
+  if ((contrast_ != static_cast<qreal>(1)
+       || intensity_ != static_cast<qreal>(1)
+       || saturation_ != static_cast<qreal>(1))
+      && !qobject_cast<QMenu*>(widget)
+      && !widget->inherits("QTipLabel")
+      && ((widget->windowFlags() & Qt::WindowType_Mask) != Qt::ToolTip
+          && !qobject_cast<QFrame*>(widget)))
   {
-    KWindowEffects::enableBlurBehind (widget->internalWinId(), false);
-    if ((contrast_ != static_cast<qreal>(1)
-         || intensity_ != static_cast<qreal>(1)
-         || saturation_ != static_cast<qreal>(1))
-        && !qobject_cast<QMenu*>(widget)
-        && !widget->inherits("QTipLabel")
-        && ((widget->windowFlags() & Qt::WindowType_Mask) != Qt::ToolTip
-            && !qobject_cast<QFrame*>(widget)))
-    {
-      KWindowEffects::enableBackgroundContrast (widget->internalWinId(), false);
-    }
+    KWindowEffects::enableBackgroundContrast (id, false);
   }
+  return true;
 #elif defined Q_WS_X11 || defined Q_OS_LINUX
-    XDeleteProperty (QX11Info::display(), widget->internalWinId(), atom_blur_);
+  XDeleteProperty (QX11Info::display(), id, atom_blur_);
+  return true;
 #else
-  Q_UNUSED (widget);
+  return false;
 #endif
 }
 }
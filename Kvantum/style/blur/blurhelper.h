@@ -68,28 +68,27 @@ class BlurHelper: public QObject
     /* The blur-behind region for a given widget. */
     QRegion blurRegion (QWidget*) const;
 
-    /* Update blur region for all pending widgets. A timer is
-       used to allow some buffering of the update requests. */
+    /* Update blur region for all pending widgets. A timer is used
+       to allow some buffering of the update requests, so that several
+       events of a window (like Show and Resize) result in one update. */
     void delayedUpdate (void)
     {
       if (!timer_.isActive())
-        timer_.start (10, this);
-    }
-    void update (void)
-    {
-      for (const WidgetPointer& widget : static_cast<const WidgetSet&>(pendingWidgets_))
-      {
-        if (widget)
-          update (widget.data());
-      }
-      pendingWidgets_.clear();
+        timer_.start (16, this);
     }
+    void update (void);
 
-    /* Update blur regions for given widget. */
-    void update (QWidget*) const;
+    /* Update blur regions for given widget. Returns true if
+       a window property has been changed. */
+    bool update (QWidget*);
 
-    /* Clear blur regions for given widget. */
-    void clear (QWidget*) const;
+    /* Clear blur regions for given widget. Returns true if
+       a window property has been changed. */
+    bool clear (QWidget*);
+
+  private Q_SLOTS:
+
+    void widgetDestroyed (QObject*);
 
   private:
 
@@ -98,6 +97,17 @@ class BlurHelper: public QObject
     typedef QHash<QWidget*, WidgetPointer> WidgetSet;
     WidgetSet pendingWidgets_;
 
+    /* The regions that were last set for windows, so that the
+       window properties aren't changed when nothing is changed
+       (as with submenus that are shown and hidden repeatedly).
+       They're kept while windows are hidden and are removed only
+       when windows are unregistered or destroyed. */
+    typedef struct {
+      WId winId;
+      QRegion region;
+    } blur_region;
+    QHash<const QWidget*, blur_region> sentRegions_;
+
     /* Delayed update timer. */
     QBasicTimer timer_;
 
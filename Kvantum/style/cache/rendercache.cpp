@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rendercache.h"
+
+namespace Kvantum {
+
+RenderCache::RenderCache(qint64 budget)
+{
+  budget_ = qMax(budget, static_cast<qint64>(0));
+  size_ = 0;
+  hits_ = misses_ = evictions_ = 0;
+}
+
+void RenderCache::setBudget(qint64 budget)
+{
+  budget_ = qMax(budget, static_cast<qint64>(0));
+  trim();
+}
+
+bool RenderCache::find(const render_key &key, QPixmap *pixmap)
+{
+  QHash<render_key, std::list<cache_entry>::iterator>::const_iterator it = index_.constFind(key);
+  if (it == index_.constEnd())
+  {
+    ++misses_;
+    return false;
+  }
+  ++hits_;
+  std::list<cache_entry>::iterator entry = it.value();
+  if (entry != entries_.begin())
+    entries_.splice(entries_.begin(), entries_, entry); // iterators remain valid
+  if (pixmap)
+    *pixmap = entry->pixmap;
+  return true;
+}
+
+void RenderCache::insert(const render_key &key, const QPixmap &pixmap)
+{
+  QHash<render_key, std::list<cache_entry>::iterator>::iterator it = index_.find(key);
+  if (it != index_.end())
+  {
+    size_ -= it.value()->cost;
+    entries_.erase(it.value());
+    index_.erase(it);
+  }
+
+  qint64 cost = static_cast<qint64>(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+  if (cost > budget_) return; // it would evict everything else
+
+  cache_entry entry;
+  entry.key = key;
+  entry.pixmap = pixmap;
+  entry.cost = cost;
+  entries_.push_front(entry);
+  index_.insert(key, entries_.begin());
+  size_ += cost;
+
+  trim();
+}
+
+void RenderCache::clear()
+{
+  entries_.clear();
+  index_.clear();
+  size_ = 0;
+}
+
+void RenderCache::trim()
+{
+  while (size_ > budget_ && !entries_.empty())
+  {
+    const cache_entry &last = entries_.back();
+    index_.remove(last.key);
+    size_ -= last.cost;
+    entries_.pop_back();
+    ++evictions_;
+  }
+}
+
+}
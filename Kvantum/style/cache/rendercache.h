@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RENDERCACHE_H
+#define RENDERCACHE_H
+
+#include <QHash>
+#include <QPixmap>
+#include <list>
+
+namespace Kvantum {
+
+/* The key of a rasterized SVG element */
+typedef struct {
+  int id; // interned element ID (the state is a part of the element name)
+  int width, height; // logical size
+  qreal pixelRatio;
+  int kind; // see RenderCache::Kind
+} render_key;
+
+inline bool operator==(const render_key &k1, const render_key &k2)
+{
+  return k1.id == k2.id
+         && k1.width == k2.width && k1.height == k2.height
+         && k1.pixelRatio == k2.pixelRatio
+         && k1.kind == k2.kind;
+}
+
+inline uint qHash(const render_key &key, uint seed = 0)
+{
+  return ::qHash(key.id, seed) ^ ::qHash((key.width << 16) | (key.height & 0xffff))
+         ^ ::qHash((qRound(key.pixelRatio * 100) << 4) | key.kind);
+}
+
+/* A size-bounded LRU cache of the pixmaps rasterized by Kvantum.
+   Unlike QPixmapCache, it isn't shared with the application, so
+   our pixmaps can't be evicted by the app's own pixmaps. */
+class RenderCache
+{
+  public:
+    enum Kind {
+      FramePart, // a part of a frame, rasterized with its size
+      Pattern, // a pattern tile
+      WindowBg // the whole background of a translucent window
+    };
+
+    RenderCache(qint64 budget = 16*1024*1024);
+
+    /* Set the maximum size of the cache in bytes
+       (the least recently used pixmaps may be evicted). */
+    void setBudget(qint64 budget);
+    qint64 budget() const {
+      return budget_;
+    }
+    /* The total size of cached pixmaps in bytes */
+    qint64 size() const {
+      return size_;
+    }
+
+    /* Find a pixmap and make it the most recently used one. */
+    bool find(const render_key &key, QPixmap *pixmap);
+    void insert(const render_key &key, const QPixmap &pixmap);
+    /* Remove all pixmaps (the counters aren't reset). */
+    void clear();
+
+    quint64 hits() const {
+      return hits_;
+    }
+    quint64 misses() const {
+      return misses_;
+    }
+    quint64 evictions() const {
+      return evictions_;
+    }
+
+  private:
+    typedef struct {
+      render_key key;
+      QPixmap pixmap;
+      qint64 cost;
+    } cache_entry;
+
+    /* Evict the least recently used pixmaps until the size isn't greater than the budget. */
+    void trim();
+
+    std::list<cache_entry> entries_; // the most recently used entry comes first
+    QHash<render_key, std::list<cache_entry>::iterator> index_;
+    qint64 budget_;
+    qint64 size_;
+    quint64 hits_, misses_, evictions_;
+};
+
+}
+
+#endif
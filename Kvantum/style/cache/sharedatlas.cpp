@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "sharedatlas.h"
+#include <QCryptographicHash>
+#include <cstring> // memcmp, memcpy
+#include <unistd.h> // getuid
+
+namespace Kvantum {
+
+static const quint32 atlasMagic = 0x4b564154; // "KVAT"
+static const int atlasVersion = 2; // increase it whenever the layout changes
+static const int maxProbes = 32;
+
+/* FNV-1a, which, unlike qHash(), gives the same value in all processes */
+static inline quint64 elementKey(const QString &element)
+{
+  quint64 h = Q_UINT64_C(14695981039346656037);
+  const ushort *c = element.utf16();
+  for (int i = 0; i < element.size(); ++i)
+  {
+    h ^= c[i];
+    h *= Q_UINT64_C(1099511628211);
+  }
+  return h;
+}
+
+SharedAtlas::SharedAtlas(const QString &theme, qreal pixelRatio, int sizeMiB) :
+  header_(nullptr),
+  slots_(nullptr),
+  data_(nullptr),
+  pixelRatio_(pixelRatio)
+{
+  QByteArray id = QCryptographicHash::hash((theme + QString::number(atlasVersion)).toUtf8(),
+                                           QCryptographicHash::Md5).toHex();
+  memory_.setKey(QStringLiteral("kvantum-atlas-%1-%2-%3")
+                 .arg(getuid())
+                 .arg(QString::fromLatin1(id))
+                 .arg(qRound(pixelRatio * 100)));
+
+  const quint32 slotCount = 4096;
+  const quint32 dataOffset = (sizeof(atlas_header) + slotCount * sizeof(atlas_slot) + 15) & ~15u;
+  const quint32 size = static_cast<quint32>(qBound(1, sizeMiB, 1024)) * 1024 * 1024;
+  if (size <= dataOffset) return;
+
+  bool created = memory_.create(size);
+  if (!created && (memory_.error() != QSharedMemory::AlreadyExists || !memory_.attach()))
+    return;
+
+  header_ = static_cast<atlas_header*>(memory_.data());
+  slots_ = reinterpret_cast<atlas_slot*>(static_cast<uchar*>(memory_.data()) + sizeof(atlas_header));
+  data_ = static_cast<uchar*>(memory_.data()) + dataOffset;
+
+  if (created)
+  { // the new segment is zero-filled
+    memory_.lock();
+    header_->slotCount = slotCount;
+    header_->dataSize = size - dataOffset;
+    header_->used = 0;
+    header_->tiles = 0;
+    reinterpret_cast<QBasicAtomicInt*>(&header_->magic)->storeRelease(static_cast<int>(atlasMagic));
+    memory_.unlock();
+  }
+  else if (memory_.size() < static_cast<int>(size))
+  { // made by another process with a different size
+    memory_.detach();
+    header_ = nullptr;
+  }
+}
+
+SharedAtlas::~SharedAtlas()
+{
+  if (memory_.isAttached())
+    memory_.detach();
+}
+
+int SharedAtlas::findSlot(const QString &element, quint64 key,
+                          const QSize &pixelSize, bool forInsertion) const
+{
+  if (!header_
+      || static_cast<quint32>(reinterpret_cast<QBasicAtomicInt*>(&header_->magic)->loadAcquire()) != atlasMagic)
+  {
+    return -1; // not initialized yet
+  }
+  const quint32 count = header_->slotCount;
+  /* mix the size into the starting slot because an element may have many sizes */
+  const quint64 h = key ^ (static_cast<quint64>(pixelSize.width()) << 32) ^ static_cast<quint64>(pixelSize.height()) * 31;
+  for (int i = 0; i < maxProbes; ++i)
+  {
+    int index = static_cast<int>((h + i) % count);
+    atlas_slot &slot = slots_[index];
+    if (!slot.ready.loadAcquire())
+      return forInsertion ? index : -1;
+    /* the hash is only a shortcut; the name and size decide */
+    if (slot.key == key
+        && slot.width == static_cast<quint32>(pixelSize.width())
+        && slot.height == static_cast<quint32>(pixelSize.height())
+        && slot.nameLength == static_cast<quint32>(element.size())
+        && memcmp(data_ + slot.nameOffset, element.utf16(),
+                  element.size() * sizeof(ushort)) == 0)
+    {
+      return forInsertion ? -1 : index;
+    }
+  }
+  return -1;
+}
+
+QImage SharedAtlas::find(const QString &element, const QSize &size) const
+{
+  const QSize pixelSize = (QSizeF(size) * pixelRatio_).toSize();
+  int index = findSlot(element, elementKey(element), pixelSize, false);
+  if (index < 0)
+    return QImage();
+  const atlas_slot &slot = slots_[index];
+  QImage image(const_cast<const uchar*>(data_ + slot.offset),
+               slot.width, slot.height, slot.bytesPerLine,
+               QImage::Format_ARGB32_Premultiplied);
+  image.setDevicePixelRatio(pixelRatio_);
+  return image;
+}
+
+bool SharedAtlas::insert(const QString &element, const QImage &image)
+{
+  if (!header_ || image.isNull()
+      || image.format() != QImage::Format_ARGB32_Premultiplied
+      || header_->full.loadAcquire())
+  {
+    return false;
+  }
+  const quint64 key = elementKey(element);
+  const quint32 nameBytes = element.size() * sizeof(ushort);
+  const quint32 bytes = static_cast<quint32>(image.bytesPerLine()) * image.height();
+
+  if (!memory_.lock())
+    return false;
+  bool res = false;
+  int index = findSlot(element, key, image.size(), true);
+  if (index >= 0)
+  {
+    /* the name is followed by the pixels, which are aligned */
+    const quint32 nameOffset = header_->used;
+    const quint32 offset = (nameOffset + nameBytes + 15) & ~15u;
+    if (header_->tiles >= header_->slotCount / 4 * 3
+        || offset + bytes > header_->dataSize)
+    {
+      header_->full.storeRelease(1);
+    }
+    else
+    {
+      memcpy(data_ + nameOffset, element.utf16(), nameBytes);
+      memcpy(data_ + offset, image.constBits(), bytes);
+      atlas_slot &slot = slots_[index];
+      slot.key = key;
+      slot.width = image.width();
+      slot.height = image.height();
+      slot.bytesPerLine = image.bytesPerLine();
+      slot.offset = offset;
+      slot.nameOffset = nameOffset;
+      slot.nameLength = element.size();
+      header_->used = offset + bytes;
+      ++header_->tiles;
+      slot.ready.storeRelease(1); // readers don't lock the memory
+      res = true;
+    }
+  }
+  memory_.unlock();
+  return res;
+}
+
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SHAREDATLAS_H
+#define SHAREDATLAS_H
+
+#include <QSharedMemory>
+#include <QImage>
+
+namespace Kvantum {
+
+/* An optional store of rasterized SVG elements in shared memory.
+   The first process that uses a theme with a pixel ratio creates it
+   and all processes of the same user add tiles to it, so that every
+   tile is rasterized once per session and its pixels are shared.
+
+   Tiles are never removed. The store is full when its data area can't
+   hold a new tile or when 3/4 of its slots are used (to keep probing
+   short). Then nothing is added to it and processes cache the tiles
+   they rasterize themselves. A store is reset only by being recreated:
+   each theme, SVG modification and pixel ratio has its own segment,
+   which is destroyed when the last process detaches from it. */
+class SharedAtlas
+{
+  public:
+    /* "theme" identifies the SVG image (including its modification time) */
+    SharedAtlas(const QString &theme, qreal pixelRatio, int sizeMiB);
+    ~SharedAtlas();
+
+    bool isValid() const {
+      return header_ != nullptr;
+    }
+    qreal pixelRatio() const {
+      return pixelRatio_;
+    }
+
+    /* Find the tile of an element with the given logical size. The returned
+       image refers to the shared memory and shouldn't be modified. */
+    QImage find(const QString &element, const QSize &size) const;
+    /* Add the tile of an element (rasterized with the pixel ratio of the atlas).
+       Returns false if the store is full or if the tile exists. */
+    bool insert(const QString &element, const QImage &image);
+
+  private:
+    typedef struct {
+      quint32 magic; // written last by the creator
+      quint32 slotCount;
+      quint32 dataSize;
+      quint32 used; // used bytes of the data area
+      quint32 tiles; // used slots
+      QBasicAtomicInt full; // is nothing added anymore?
+    } atlas_header;
+
+    typedef struct {
+      QBasicAtomicInt ready; // is the tile written?
+      quint32 width, height; // device pixels
+      quint32 bytesPerLine;
+      quint32 offset; // offset of the pixels in the data area
+      quint32 nameOffset; // offset of the element name (UTF-16) in the data area
+      quint32 nameLength;
+      quint64 key; // hash of the element name
+    } atlas_slot;
+
+    int findSlot(const QString &element, quint64 key,
+                 const QSize &pixelSize, bool forInsertion) const;
+
+    QSharedMemory memory_;
+    atlas_header *header_;
+    atlas_slot *slots_;
+    uchar *data_;
+    qreal pixelRatio_;
+};
+
+}
+
+#endif
@@ -130,66 +130,140 @@ void Style::drawBg(QPainter *p, const QWidget *widget) const
   if (widget->palette().color(widget->backgroundRole()) == Qt::transparent)
     return; // Plasma FIXME: needed?
   QRect bgndRect(widget->rect());
-  interior_spec ispec = getInteriorSpec(QStringLiteral("DialogTranslucent"));
-  size_spec sspec = getSizeSpec(QStringLiteral("DialogTranslucent"));
-  if (ispec.element.isEmpty())
-  {
-    ispec = getInteriorSpec(QStringLiteral("Dialog"));
-    sspec = getSizeSpec(QStringLiteral("Dialog"));
-  }
-  if (!ispec.element.isEmpty()
-      && !widget->windowFlags().testFlag(Qt::FramelessWindowHint)) // not a panel
+
+  /* the specs are found only once for each window (see QEvent::Hide,
+     QEvent::Show and QEvent::ChildAdded) */
+  QHash<const QWidget*, window_bg>::iterator it = windowBgs_.find(widget);
+  if (it == windowBgs_.end())
   {
-    if (QWidget *child = widget->childAt(0,0))
-    { // even dialogs may have menubar or toolbar (as in Qt Designer)
-      if (qobject_cast<QMenuBar*>(child) || qobject_cast<QToolBar*>(child))
-      {
-        ispec = getInteriorSpec(QStringLiteral("WindowTranslucent"));
-        sspec = getSizeSpec(QStringLiteral("WindowTranslucent"));
-        if (ispec.element.isEmpty())
+    window_bg bg;
+    interior_spec &ispec = bg.ispec;
+    size_spec &sspec = bg.sspec;
+    ispec = getInteriorSpec(QStringLiteral("DialogTranslucent"));
+    sspec = getSizeSpec(QStringLiteral("DialogTranslucent"));
+    if (ispec.element.isEmpty())
+    {
+      ispec = getInteriorSpec(QStringLiteral("Dialog"));
+      sspec = getSizeSpec(QStringLiteral("Dialog"));
+    }
+    if (!ispec.element.isEmpty()
+        && !widget->windowFlags().testFlag(Qt::FramelessWindowHint)) // not a panel
+    {
+      if (QWidget *child = widget->childAt(0,0))
+      { // even dialogs may have menubar or toolbar (as in Qt Designer)
+        if (qobject_cast<QMenuBar*>(child) || qobject_cast<QToolBar*>(child))
         {
-          ispec = getInteriorSpec(QStringLiteral("Window"));
-          sspec = getSizeSpec(QStringLiteral("Window"));
+          ispec = getInteriorSpec(QStringLiteral("WindowTranslucent"));
+          sspec = getSizeSpec(QStringLiteral("WindowTranslucent"));
+          if (ispec.element.isEmpty())
+          {
+            ispec = getInteriorSpec(WindowClass);
+            sspec = getSizeSpec(WindowClass);
+          }
         }
       }
     }
-  }
-  else
-  {
-    ispec = getInteriorSpec(QStringLiteral("WindowTranslucent"));
-    sspec = getSizeSpec(QStringLiteral("WindowTranslucent"));
-    if (ispec.element.isEmpty())
+    else
     {
-      ispec = getInteriorSpec(QStringLiteral("Window"));
-      sspec = getSizeSpec(QStringLiteral("Window"));
+      ispec = getInteriorSpec(QStringLiteral("WindowTranslucent"));
+      sspec = getSizeSpec(QStringLiteral("WindowTranslucent"));
+      if (ispec.element.isEmpty())
+      {
+        ispec = getInteriorSpec(WindowClass);
+        sspec = getSizeSpec(WindowClass);
+      }
     }
+    if (tspec_.no_window_pattern && (ispec.px > 0 || ispec.py > 0))
+      ispec.px = -2; // no tiling pattern with translucency
+    bg.isInactive = false;
+    bg.painted = false;
+    bg.rendered = true;
+    it = windowBgs_.insert(widget, bg);
   }
-  frame_spec fspec;
-  default_frame_spec(fspec);
+  window_bg &bg = it.value();
 
-  QString suffix = "-normal";
-  if (isWidgetInactive(widget))
-    suffix = "-normal-inactive";
-
-  if (tspec_.no_window_pattern && (ispec.px > 0 || ispec.py > 0))
-    ispec.px = -2; // no tiling pattern with translucency
+  bool isInactive = isWidgetInactive(widget);
+  const int bgState = isInactive ? (NormalState | InactiveState) : NormalState;
 
   p->setClipRegion(bgndRect, Qt::IntersectClip);
+
   int ro = tspec_.reduce_window_opacity;
+  bool rendered = false;
+  /* if there was nothing to render, don't try again before a state change */
+  if (!bg.painted || bg.rendered || bg.isInactive != isInactive)
+  {
+    qreal pixelRatio = qApp->devicePixelRatio();
+    if (p->device())
+      pixelRatio = p->device()->devicePixelRatioF();
+    pixelRatio = qMax(pixelRatio, static_cast<qreal>(1));
+
+    /* While the window is being resized, its background is painted directly
+       (the pattern tiles come from the render cache). When it's painted with
+       the same size again, the whole background is rasterized and cached,
+       unless it's too large for the render cache. */
+    bool sameSize(bg.painted && bg.isInactive == isInactive
+                  && bg.size == bgndRect.size());
+    bg.painted = true;
+    bg.size = bgndRect.size();
+    bg.isInactive = isInactive;
+
+    const render_key key = {bg.ispec.elementId < 0
+                              ? -1 : stateElementId(bg.ispec.elementId,bgState),
+                            bgndRect.width(), bgndRect.height(), pixelRatio,
+                            RenderCache::WindowBg};
+    const QSize pixmapSize = (QSizeF(bgndRect.size())*pixelRatio).toSize();
+    QPixmap pixmap;
+    int dh = bg.sspec.incrementH ? bg.sspec.minH : qMax(bg.sspec.minH - bgndRect.height(), 0);
+    int dw = bg.sspec.incrementW ? bg.sspec.minW : qMax(bg.sspec.minW - bgndRect.width(), 0);
+    frame_spec fspec;
+    default_frame_spec(fspec);
+    if (renderCache_.find(key, &pixmap))
+      rendered = true;
+    else if (sameSize
+             && static_cast<qint64>(pixmapSize.width())*pixmapSize.height()*4
+                <= renderCache_.budget()/4)
+    {
+      pixmap = QPixmap(pixmapSize);
+      pixmap.setDevicePixelRatio(pixelRatio);
+      pixmap.fill(Qt::transparent);
+      QPainter painter(&pixmap);
+      if (ro > 0)
+        painter.setOpacity(1.0 - static_cast<qreal>(ro)/100.0);
+      rendered = renderInterior(&painter,bgndRect.adjusted(0,0,dw,dh),fspec,bg.ispec,bg.ispec.elementId,bgState);
+      painter.end();
+      if (rendered)
+        renderCache_.insert(key, pixmap);
+    }
+    else
+    { // paint directly, as when there's no render cache
+      if (ro > 0)
+      {
+        p->save();
+        p->setOpacity(1.0 - static_cast<qreal>(ro)/100.0);
+      }
+      rendered = renderInterior(p,bgndRect.adjusted(0,0,dw,dh),fspec,bg.ispec,bg.ispec.elementId,bgState);
+      if (ro > 0)
+        p->restore();
+    }
+    bg.rendered = rendered;
+    if (rendered)
+    {
+      if (!pixmap.isNull())
+        p->drawPixmap(bgndRect.topLeft(), pixmap);
+      return;
+    }
+  }
+
+  /* no window interior element but with reduced translucency */
   if (ro > 0)
   {
     p->save();
-    p->setOpacity(1.0 - static_cast<qreal>(tspec_.reduce_window_opacity)/100.0);
-  }
-  int dh = sspec.incrementH ? sspec.minH : qMax(sspec.minH - bgndRect.height(), 0);
-  int dw = sspec.incrementW ? sspec.minW : qMax(sspec.minW - bgndRect.width(), 0);
-  if (!renderInterior(p,bgndRect.adjusted(0,0,dw,dh),fspec,ispec,ispec.element+suffix))
-  { // no window interior element but with reduced translucency
-    p->fillRect(bgndRect, standardPalette().color(suffix.contains("-inactive")
-                                                    ? QPalette::Inactive
-                                                    : QPalette::Active,
-                                                  QPalette::Window));
+    p->setOpacity(1.0 - static_cast<qreal>(ro)/100.0);
   }
+  p->fillRect(bgndRect, standardPalette().color(isInactive
+                                                  ? QPalette::Inactive
+                                                  : QPalette::Active,
+                                                QPalette::Window));
   if (ro > 0)
     p->restore();
 }
@@ -211,15 +285,15 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         if (pb->maximum() == 0 && pb->minimum() == 0)
         { // add the busy progress bar to the list
           if (!progressbars_.contains(w))
-          {
             progressbars_.insert(w, 0);
-            if (!progressTimer_->isActive())
-              progressTimer_->start(50);
-          }
+          /* the timer may have been stopped because no bar could be seen */
+          if (!progressTimer_->isActive())
+            progressTimer_->start();
         }
         else if (!progressbars_.isEmpty())
         {
           progressbars_.remove(w);
+          busyIndicators_.remove(w);
           if (progressbars_.size() == 0)
             progressTimer_->stop();
         }
@@ -297,7 +371,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         }
 
         bool isInactive(isWidgetInactive(cbtn));
-        const label_spec lspec = getLabelSpec("PanelButtonCommand");
+        const label_spec lspec = getLabelSpec(PanelButtonCommandClass);
 
         /* find the state and set the text color accordingly */
         int state;
@@ -309,33 +383,33 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         {
           state = 4;
           if (isInactive)
-            col = getFromRGBA(lspec.toggleInactiveColor);
+            col = lspec.toggleInactiveColor;
           if (!col.isValid())
-            col = getFromRGBA(lspec.toggleColor);
+            col = lspec.toggleColor;
         }
         else if (cbtn->isDown())
         {
           state = 3;
           if (isInactive)
-            col = getFromRGBA(lspec.pressInactiveColor);
+            col = lspec.pressInactiveColor;
           if (!col.isValid())
-            col = getFromRGBA(lspec.pressColor);
+            col = lspec.pressColor;
         }
         else if (cbtn->underMouse())
         {
           state = 2;
           if (isInactive)
-            col = getFromRGBA(lspec.focusInactiveColor);
+            col = lspec.focusInactiveColor;
           if (!col.isValid())
-            col = getFromRGBA(lspec.focusColor);
+            col = lspec.focusColor;
         }
         else
         {
           state = 1;
           if (isInactive)
-            col = getFromRGBA(lspec.normalInactiveColor);
+            col = lspec.normalInactiveColor;
           if (!col.isValid())
-            col = getFromRGBA(lspec.normalColor);
+            col = lspec.normalColor;
         }
         if (col.isValid())
         {
@@ -440,7 +514,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         {
           /* the cursor has moved to a tab adjacent to the active tab */
           QRect r = tabbar->tabRect(indx);
-          const frame_spec fspec = getFrameSpec(QStringLiteral("Tab"));
+          const frame_spec fspec = getFrameSpec(TabClass);
           int overlap = tspec_.active_tab_overlap;
           int exp = qMin(fspec.expansion, qMin(r.width(), r.height())) / 2 + 1;
           overlap = qMin(overlap, qMax(exp, qMax(fspec.left, fspec.right)));
@@ -487,7 +561,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
       if (indx > -1 && qAbs(indx - tabbar->currentIndex()) == 1)
       {
         QRect r = tabbar->tabRect(indx);
-        const frame_spec fspec = getFrameSpec(QStringLiteral("Tab"));
+        const frame_spec fspec = getFrameSpec(TabClass);
         int overlap = tspec_.active_tab_overlap;
         int exp = qMin(fspec.expansion, qMin(r.width(), r.height())) / 2 + 1;
         overlap = qMin(overlap, qMax(exp, qMax(fspec.left, fspec.right)));
@@ -533,24 +607,24 @@ bool Style::eventFilter(QObject *o, QEvent *e)
       else if (qobject_cast<QComboBox*>(o))
       {
         if (!w->hasFocus())
-          animationStartState_ = "normal";
+          animationStartState_ = NormalState;
         /* the popup may have been closed (with Qt5) */
-        else if (!(animatedWidget_ == w && animationStartState_.startsWith("c-toggled")))
-          animationStartState_ = "pressed";
+        else if (!(animatedWidget_ == w && (animationStartState_ & ComboState)))
+          animationStartState_ = PressedState;
         if (isWidgetInactive(w))
-          animationStartState_.append("-inactive");
+          animationStartState_ |= InactiveState;
         animatedWidget_ = w;
         animationOpacity_ = 0;
-        opacityTimer_->start(ANIMATION_FRAME);
+        opacityTimer_->start();
       }
       else if (qobject_cast<QScrollBar*>(o) || qobject_cast<QSlider*>(o))
       {
-        animationStartState_ = "normal";
+        animationStartState_ = NormalState;
         if (isWidgetInactive(w))
-          animationStartState_.append("-inactive");
+          animationStartState_ |= InactiveState;
         animatedWidget_ = w;
         animationOpacity_ = 0;
-        opacityTimer_->start(ANIMATION_FRAME);
+        opacityTimer_->start();
       }
     }
     break;
@@ -569,23 +643,23 @@ bool Style::eventFilter(QObject *o, QEvent *e)
           animatedWidget_->update();
         }
         if (!(animatedWidget_ == w
-              && (animationStartState_.startsWith("c-toggled")
-                  || animationStartState_.startsWith("normal"))))
+              && ((animationStartState_ & ComboState)
+                  || baseState(animationStartState_) == NormalState)))
         { // it was hidden or another widget was interacted with  -- there's no other possibility
-          animationStartState_ = "normal";
+          animationStartState_ = NormalState;
           if (isWidgetInactive(w))
-            animationStartState_.append("-inactive");
+            animationStartState_ |= InactiveState;
         }
         animatedWidget_ = w;
         animationOpacity_ = 0;
-        opacityTimer_->start(ANIMATION_FRAME);
+        opacityTimer_->start();
       }
       else
       {
         QAbstractScrollArea *sa = qobject_cast<QAbstractScrollArea*>(o);
         if ((sa && !w->inherits("QComboBoxListView") // exclude combo popups
              /* no animation without the top focused generic frame */
-             && elementExists(getFrameSpec(QStringLiteral("GenericFrame")).element+"-focused-top"))
+             && elementExists(getFrameSpec(GenericFrameClass).element+"-focused-top"))
             || (qobject_cast<QLineEdit*>(o)
                 // this is only needed for Qt5 -- Qt4 combo lineedits don't have FocusIn event
                 && !qobject_cast<QComboBox*>(w->parentWidget()))
@@ -626,10 +700,10 @@ bool Style::eventFilter(QObject *o, QEvent *e)
               animatedWidget_->update();
             }
           }
-          animationStartState_ = "normal";
+          animationStartState_ = NormalState;
           animatedWidget_ = w;
           animationOpacity_ = 0;
-          opacityTimer_->start(ANIMATION_FRAME);
+          opacityTimer_->start();
         }
       }
     }
@@ -647,7 +721,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
           || (qobject_cast<QAbstractScrollArea*>(o)
               && !w->inherits("QComboBoxListView") // exclude combo popups
               /* no animation without the top focused generic frame */
-              && elementExists(getFrameSpec(QStringLiteral("GenericFrame")).element+"-focused-top")))
+              && elementExists(getFrameSpec(GenericFrameClass).element+"-focused-top")))
       {
         /* disable animation if focus-out happens immediately after focus-in
            for exactly the same area to prevent flashing */
@@ -661,7 +735,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
           opacityTimer_->stop();
           animationOpacity_ = 100;
           animatedWidget_ = nullptr;
-          animationStartState_ = "normal"; // should be set; no animation after this
+          animationStartState_ = NormalState; // should be set; no animation after this
           break;
         }
         if (animatedWidgetOut_ && opacityTimerOut_->isActive())
@@ -673,13 +747,13 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         if (qobject_cast<QComboBox*>(o)
             && !((tspec_.combo_as_lineedit || tspec_.square_combo_button) && qobject_cast<QComboBox*>(o)->lineEdit()))
         {
-          animationStartStateOut_ = "pressed";
+          animationStartStateOut_ = PressedState;
         }
         else
-          animationStartStateOut_ = "focused";
+          animationStartStateOut_ = FocusedState;
         animatedWidgetOut_ = w;
         animationOpacityOut_ = 0;
-        opacityTimerOut_->start(ANIMATION_FRAME);
+        opacityTimerOut_->start();
       }
     }
     break;
@@ -710,7 +784,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
       {
         animatedWidget_ = w;
         animationOpacity_ = 0;
-        opacityTimer_->start(ANIMATION_FRAME);
+        opacityTimer_->start();
       }
     }
     break;
@@ -753,7 +827,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         }
         animatedWidget_ = w;
         animationOpacity_ = 0;
-        opacityTimer_->start(ANIMATION_FRAME);
+        opacityTimer_->start();
       }
     }
     break;
@@ -805,7 +879,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         }
         animatedWidget_ = w;
         animationOpacity_ = 0;
-        opacityTimer_->start(ANIMATION_FRAME);
+        opacityTimer_->start();
       }
     }
     break;
@@ -849,10 +923,10 @@ bool Style::eventFilter(QObject *o, QEvent *e)
       { // Custom text color; don't set palettes! The app is responsible for all colors.
         break;
       }
-      const label_spec lspec = getLabelSpec(QStringLiteral("ItemView"));
+      const label_spec lspec = getLabelSpec(ItemViewClass);
       /* set the normal inactive text color to the normal active one
          (needed when the app sets it inactive) */
-      QColor col = getFromRGBA(lspec.normalColor);
+      QColor col = lspec.normalColor;
       if (!col.isValid())
         col = standardPalette().color(QPalette::Active,QPalette::Text);
       else
@@ -865,7 +939,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
       }
       /* set the toggled inactive text color to the toggled active one
          (the main purpose of installing an event filter on the view) */
-      col = getFromRGBA(lspec.toggleColor);
+      col = lspec.toggleColor;
       opacifyColor(col);
       palette.setColor(QPalette::Inactive, QPalette::HighlightedText, col);
       /* use the active highlight color for the toggled (unfocused) item if there's
@@ -889,9 +963,9 @@ bool Style::eventFilter(QObject *o, QEvent *e)
       {
         break;
       }
-      const label_spec lspec = getLabelSpec(QStringLiteral("ItemView"));
+      const label_spec lspec = getLabelSpec(ItemViewClass);
       /* restore the normal inactive text color (which was changed at QEvent::WindowActivate) */
-      QColor col = getFromRGBA(lspec.normalInactiveColor);
+      QColor col = lspec.normalInactiveColor;
       if (!col.isValid())
         col = standardPalette().color(QPalette::Inactive,QPalette::Text);
       else
@@ -903,7 +977,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         break;
       }
       /* restore the toggled inactive text color (which was changed at QEvent::WindowActivate) */
-      col = getFromRGBA(lspec.toggleInactiveColor);
+      col = lspec.toggleInactiveColor;
       opacifyColor(col);
       palette.setColor(QPalette::Inactive,QPalette::HighlightedText, col);
       /* restore the inactive highlight color (which was changed at QEvent::WindowActivate) */
@@ -924,6 +998,11 @@ bool Style::eventFilter(QObject *o, QEvent *e)
       {
         popupOrigins_.insert(w, animatedWidget_);
       }
+      else if (qobject_cast<QMenuBar*>(o) || qobject_cast<QToolBar*>(o))
+      { // the background of a translucent window may change (see drawBg)
+        if (windowBgs_.remove(w->window()) > 0)
+          w->window()->update();
+      }
 
       if (QProgressBar *pb = qobject_cast<QProgressBar*>(o))
       {
@@ -932,7 +1011,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
           if (!progressbars_.contains(w))
             progressbars_.insert(w, 0);
           if (!progressTimer_->isActive())
-            progressTimer_->start(50);
+            progressTimer_->start();
         }
       }
 #if (QT_VERSION >= QT_VERSION_CHECK(5,11,0))
@@ -1027,7 +1106,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
             {
               if (parentMenubar)
               {
-                QString group = tspec_.merge_menubar_with_toolbar ? "Toolbar" : "MenuBar";
+                int group = tspec_.merge_menubar_with_toolbar ? ToolbarClass : MenuBarClass;
                 if (parentMenubar->mapToGlobal(QPoint(0,0)).y() > g.bottom())
                   dY +=  menuShadow_.at(1) + menuShadow_.at(3) + static_cast<qreal>(getFrameSpec(group).top);
                 else
@@ -1098,7 +1177,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
             {
               if (parentMenubar)
               {
-                QString group = tspec_.merge_menubar_with_toolbar ? "Toolbar" : "MenuBar";
+                int group = tspec_.merge_menubar_with_toolbar ? ToolbarClass : MenuBarClass;
                 if (parentMenubar->mapToGlobal(QPoint(0,0)).y() > g.bottom()) // menu is above menubar
                   dY +=  menuShadow_.at(1) + menuShadow_.at(3) + static_cast<qreal>(getFrameSpec(group).top);
                 else
@@ -1157,7 +1236,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         }
         else if (!parentMenu && parentMenubar)
         {
-          QString group = tspec_.merge_menubar_with_toolbar ? "Toolbar" : "MenuBar";
+          int group = tspec_.merge_menubar_with_toolbar ? ToolbarClass : MenuBarClass;
           if (parentMenubar->mapToGlobal(QPoint(0,0)).y() > g.bottom()) // menu is above menubar
             dY += static_cast<qreal>(getFrameSpec(group).top);
           else
@@ -1226,10 +1305,10 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         {
           break;
         }
-        const label_spec lspec = getLabelSpec(QStringLiteral("ItemView"));
+        const label_spec lspec = getLabelSpec(ItemViewClass);
         if (isWidgetInactive(w)) // FIXME: probably not needed with inactive window
         {
-          QColor col = getFromRGBA(lspec.normalInactiveColor);
+          QColor col = lspec.normalInactiveColor;
           if (!col.isValid())
             col = standardPalette().color(QPalette::Inactive,QPalette::Text);
           else
@@ -1240,7 +1319,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
             w->setPalette(palette);
             break;
           }
-          col = getFromRGBA(lspec.toggleInactiveColor);
+          col = lspec.toggleInactiveColor;
           opacifyColor(col);
           palette.setColor(QPalette::Inactive,QPalette::HighlightedText, col);
           if (!toggledItemHasContrast_)
@@ -1251,7 +1330,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         }
         else
         {
-          QColor col = getFromRGBA(lspec.normalColor);
+          QColor col = lspec.normalColor;
           if (!col.isValid())
             col = standardPalette().color(QPalette::Active,QPalette::Text);
           else
@@ -1262,7 +1341,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
             w->setPalette(palette);
             break;
           }
-          col = getFromRGBA(lspec.toggleColor);
+          col = lspec.toggleColor;
           opacifyColor(col);
           palette.setColor(QPalette::Inactive, QPalette::HighlightedText, col);
           if (!toggledItemHasContrast_)
@@ -1304,12 +1383,12 @@ bool Style::eventFilter(QObject *o, QEvent *e)
     }
     /* correct line-edit palettes on stylable toolbars if needed */
     else if (qobject_cast<QLineEdit*>(o)
-             && (!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-                 || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+             && (!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+                 || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
              && getStylableToolbarContainer(w, true))
     {
-      const label_spec tlspec = getLabelSpec("Toolbar");
-      QColor col = getFromRGBA(tlspec.normalColor);
+      const label_spec tlspec = getLabelSpec(ToolbarClass);
+      QColor col = tlspec.normalColor;
       if (enoughContrast(col, standardPalette().color(QPalette::Active,QPalette::Text)))
       {
         QColor col1 = col;
@@ -1322,7 +1401,7 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         opacifyColor(col1);
         palette.setColor(QPalette::PlaceholderText, col1);
 #endif
-        col1 = getFromRGBA(tlspec.normalInactiveColor);
+        col1 = tlspec.normalInactiveColor;
         if (!col1.isValid()) col1 = col;
         opacifyColor(col1);
         palette.setColor(QPalette::Inactive, QPalette::Text, col1);
@@ -1363,6 +1442,11 @@ bool Style::eventFilter(QObject *o, QEvent *e)
     break;
 
   case QEvent::Hide:
+    if (w && (qobject_cast<QMenuBar*>(o) || qobject_cast<QToolBar*>(o)))
+    { // the background of a translucent window may change (see drawBg)
+      if (windowBgs_.remove(w->window()) > 0)
+        w->window()->update();
+    }
     if (qobject_cast<QToolButton*>(o))
     {
       if (tspec_.group_toolbar_buttons)
@@ -1385,10 +1469,10 @@ bool Style::eventFilter(QObject *o, QEvent *e)
         if ((tspec_.combo_as_lineedit || tspec_.square_combo_button)
             && qobject_cast<QComboBox*>(w->parentWidget())->lineEdit())
         {
-          animationStartState_ = "normal"; // -> QEvent::FocusIn
+          animationStartState_ = NormalState; // -> QEvent::FocusIn
         }
         else
-          animationStartState_ = "c-toggled"; // distinguish it from a toggled button
+          animationStartState_ = ToggledState | ComboState; // distinguish it from a toggled button
         /* ensure that the combobox will be animated on closing popup
            (especially needed if the cursor has been on the popup) */
         animatedWidget_ = w->parentWidget();
@@ -1416,10 +1500,16 @@ bool Style::eventFilter(QObject *o, QEvent *e)
     {
       if (qobject_cast<QMenu*>(w))
         movedMenus.remove(w);
+      else if (w->isWindow())
+        windowBgs_.remove(w);
+      /* a destroyed toolbar can't be cast to QToolBar here */
+      tabbedToolbars_.remove(w);
+      toolbarLayouts_.remove(w);
 
       if (!progressbars_.isEmpty() && qobject_cast<QProgressBar*>(o))
       {
         progressbars_.remove(w);
+        busyIndicators_.remove(w);
         if (progressbars_.size() == 0)
           progressTimer_->stop();
       }
@@ -1449,6 +1539,28 @@ bool Style::eventFilter(QObject *o, QEvent *e)
     }
     break;
 
+  case QEvent::ChildAdded:
+  case QEvent::ChildRemoved:
+    /* A menubar or toolbar may have been added to or removed from a
+       translucent window (see drawBg). The child can't be cast here
+       because it may not be constructed yet or may be being destroyed. */
+    if (w && w->isWindow()
+        && static_cast<QChildEvent*>(e)->child()->isWidgetType())
+    {
+      windowBgs_.remove(w);
+    }
+    /* a tab bar may have been added to or removed from a toolbar */
+    if (qobject_cast<QToolBar*>(o))
+      tabbedToolbars_.remove(w);
+    /* Falls through. */
+
+  case QEvent::LayoutRequest:
+  case QEvent::Resize:
+    /* the tool buttons of a toolbar may be laid out again */
+    if (qobject_cast<QToolBar*>(o))
+      toolbarLayouts_.remove(w);
+    break;
+
   default:
     return false;
   }
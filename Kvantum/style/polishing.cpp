@@ -36,6 +36,7 @@
 #include <QStatusBar>
 #include <QMainWindow>
 #include <QToolBar>
+#include <QMenuBar>
 #include <QScrollBar>
 #include <QWindow>
 #include <QDialog>
@@ -156,13 +157,13 @@ void Style::polish(QWidget *widget)
 
   /* respect the toolbar text color if the widget is shown after
      its parent toolbar and without repainting it (unlike in CE_ToolBar) */
-  const label_spec tLspec = getLabelSpec(QStringLiteral("Toolbar"));
-  QColor tColor = getFromRGBA(tLspec.normalColor);
+  const label_spec tLspec = getLabelSpec(ToolbarClass);
+  QColor tColor = tLspec.normalColor;
   if (enoughContrast(standardPalette().color(QPalette::Active,QPalette::Text), tColor)
       && !qobject_cast<QToolButton*>(widget) // flat toolbuttons are dealt with at CE_ToolButtonLabel
       && getStylableToolbarContainer(widget))
   {
-    QColor inactiveCol = getFromRGBA(tLspec.normalInactiveColor);
+    QColor inactiveCol = tLspec.normalInactiveColor;
     if (!inactiveCol.isValid())
       inactiveCol = tColor;
     QColor disabledCol = tColor;
@@ -201,8 +202,8 @@ void Style::polish(QWidget *widget)
 
     if (qobject_cast<QLineEdit*>(widget))
     {
-      if (!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-          || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+      if (!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+          || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
       {
         QPalette palette = widget->palette();
         if (palette.color(QPalette::Active, QPalette::Text) != tColor)
@@ -223,10 +224,10 @@ void Style::polish(QWidget *widget)
       }
     }
     else if (qobject_cast<QComboBox*>(widget)
-            && (!getFrameSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty()
-                || !getInteriorSpec(QStringLiteral("ToolbarComboBox")).element.isEmpty()))
+            && (!getFrameSpec(ToolbarComboBoxClass).element.isEmpty()
+                || !getInteriorSpec(ToolbarComboBoxClass).element.isEmpty()))
     {
-      tColor = getFromRGBA(getLabelSpec(QStringLiteral("ToolbarComboBox")).normalColor);
+      tColor = getLabelSpec(ToolbarComboBoxClass).normalColor;
       if (tColor.isValid())
       {
         QColor disabledCol = tColor;
@@ -308,7 +309,7 @@ void Style::polish(QWidget *widget)
          and a window can have the ToolTip flag (-> LXQtGroupPopup) */
       if (qobject_cast<QMenu*>(widget))
       { // some apps (like QtAV Player) do weird things with menus
-        QColor menuTextColor = getFromRGBA(getLabelSpec(QStringLiteral("MenuItem")).normalColor);
+        QColor menuTextColor = getLabelSpec(MenuItemClass).normalColor;
         if (menuTextColor.isValid())
         {
           QPalette palette = widget->palette();
@@ -474,7 +475,7 @@ void Style::polish(QWidget *widget)
                 QList<qreal> tooltipS;
                 if (tspec_now.tooltip_shadow_depth > 0)
                 {
-                  const frame_spec fspec = getFrameSpec(QStringLiteral("ToolTip"));
+                  const frame_spec fspec = getFrameSpec(ToolTipClass);
                   int thickness = qMax(qMax(fspec.top,fspec.bottom), qMax(fspec.left,fspec.right));
                   thickness += tspec_now.tooltip_shadow_depth;
                   tooltipS = getShadow(QStringLiteral("ToolTip"), thickness);
@@ -598,8 +599,8 @@ void Style::polish(QWidget *widget)
   else if (qobject_cast<QLineEdit*>(widget) || widget->inherits("KCalcDisplay"))
   {
     if (qobject_cast<QLineEdit*>(widget)
-        && (!getFrameSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty()
-            || !getInteriorSpec(QStringLiteral("ToolbarLineEdit")).element.isEmpty())
+        && (!getFrameSpec(ToolbarLineEditClass).element.isEmpty()
+            || !getInteriorSpec(ToolbarLineEditClass).element.isEmpty())
         && getStylableToolbarContainer(widget, true))
     {
       if (!tspec_.animate_states)
@@ -651,7 +652,7 @@ void Style::polish(QWidget *widget)
             bool baseContrast(false);
             if (itemView->viewport()->findChildren<QWidget*>(QString(), Qt::FindDirectChildrenOnly).isEmpty())
             { // font menus use the palette text color, so we set it to the menu text color when needed
-              menuTextColor = getFromRGBA(getLabelSpec(QStringLiteral("MenuItem")).normalColor);
+              menuTextColor = getLabelSpec(MenuItemClass).normalColor;
               baseContrast = enoughContrast(vPalette.color(QPalette::Text), menuTextColor);
             }
 
@@ -661,7 +662,7 @@ void Style::polish(QWidget *widget)
               if (baseContrast)
               {
                 ss = QStringLiteral("QAbstractItemView{background-color: transparent; color: %1}")
-                     .arg(getLabelSpec(QStringLiteral("MenuItem")).normalColor);
+                     .arg(getLabelSpec(MenuItemClass).normalColor.name(QColor::HexArgb));
               }
               else
                 ss = QStringLiteral("QAbstractItemView{background-color: transparent;}");
@@ -690,7 +691,7 @@ void Style::polish(QWidget *widget)
               if (itemView->styleSheet() == QStringLiteral("QAbstractItemView{background-color: transparent;}")
                   || itemView->styleSheet()
                        == QStringLiteral("QAbstractItemView{background-color: transparent; color: %1}")
-                          .arg(getLabelSpec(QStringLiteral("MenuItem")).normalColor))
+                          .arg(getLabelSpec(MenuItemClass).normalColor.name(QColor::HexArgb)))
               {
                 itemView->setStyleSheet(QString());
               }
@@ -950,6 +951,10 @@ void Style::polish(QWidget *widget)
       }
     }
   }
+  else if (qobject_cast<QToolBar*>(widget))
+    widget->installEventFilter(this); // see toolbarHasTabBar() and whichGroupedTBtn()
+  else if (qobject_cast<QMenuBar*>(widget))
+    widget->installEventFilter(this); // see drawBg()
   // update grouped toolbar buttons when one of them is shown/hidden
   else if (!tspec_.animate_states // otherwise it already has event filter installed on it
            && tspec_.group_toolbar_buttons && qobject_cast<QToolButton*>(widget))
@@ -1019,7 +1024,7 @@ void Style::polish(QWidget *widget)
           QList<qreal> tooltipS;
           if (tspec_now.tooltip_shadow_depth > 0)
           {
-            const frame_spec fspec = getFrameSpec(QStringLiteral("ToolTip"));
+            const frame_spec fspec = getFrameSpec(ToolTipClass);
             int thickness = qMax(qMax(fspec.top,fspec.bottom), qMax(fspec.left,fspec.right));
             thickness += tspec_now.tooltip_shadow_depth;
             tooltipS = getShadow(QStringLiteral("ToolTip"), thickness);
@@ -1157,6 +1162,14 @@ void Style::unpolish(QWidget *widget)
     }
     else if (qobject_cast<QToolBox*>(widget))
       widget->setBackgroundRole(QPalette::Button);
+    else if (qobject_cast<QMenuBar*>(widget))
+      widget->removeEventFilter(this);
+    else if (qobject_cast<QToolBar*>(widget))
+    {
+      widget->removeEventFilter(this);
+      tabbedToolbars_.remove(widget);
+      toolbarLayouts_.remove(widget);
+    }
 
 #if (QT_VERSION >= QT_VERSION_CHECK(5,13,1))
     if (hspec_.kinetic_scrolling)
@@ -1238,24 +1251,24 @@ QPalette Style::standardPalette() const
   bool hasInactiveness(!tspec_.no_inactiveness);
 
   /* background colors */
-  QColor col = getFromRGBA(cspec_.windowColor);
+  QColor col = cspec_.windowColor;
   if (col.isValid())
   {
     standardPalette_.setColor(QPalette::Active,QPalette::Window,col);
     standardPalette_.setColor(QPalette::Disabled,QPalette::Window,col); // used in generatedIconPixmap()
-    col1 = getFromRGBA(cspec_.inactiveWindowColor);
+    col1 = cspec_.inactiveWindowColor;
     if (col1.isValid() && hasInactiveness)
       standardPalette_.setColor(QPalette::Inactive,QPalette::Window,col1);
     else
       standardPalette_.setColor(QPalette::Inactive,QPalette::Window,col);
   }
 
-  col = getFromRGBA(cspec_.baseColor);
+  col = cspec_.baseColor;
   if (col.isValid())
   {
     standardPalette_.setColor(QPalette::Active,QPalette::Base,col);
     standardPalette_.setColor(QPalette::Disabled,QPalette::Base,col); // some apps may use it
-    col1 = getFromRGBA(cspec_.inactiveBaseColor);
+    col1 = cspec_.inactiveBaseColor;
     if (col1.isValid() && hasInactiveness)
       standardPalette_.setColor(QPalette::Inactive,QPalette::Base,col1);
     else
@@ -1264,12 +1277,12 @@ QPalette Style::standardPalette() const
   else // just to know that all brushes are set
     standardPalette_.setColor(QPalette::Active,QPalette::Base,QColor(Qt::white));
 
-  col = getFromRGBA(cspec_.altBaseColor);
+  col = cspec_.altBaseColor;
   if (col.isValid())
   {
     standardPalette_.setColor(QPalette::Active,QPalette::AlternateBase,col);
     standardPalette_.setColor(QPalette::Disabled,QPalette::AlternateBase,col);
-    col1 = getFromRGBA(cspec_.inactiveAltBaseColor);
+    col1 = cspec_.inactiveAltBaseColor;
     if (col1.isValid() && hasInactiveness)
       standardPalette_.setColor(QPalette::Inactive,QPalette::AlternateBase,col1);
     else
@@ -1290,32 +1303,32 @@ QPalette Style::standardPalette() const
     standardPalette_.setColor(QPalette::Inactive,QPalette::AlternateBase,col);
   }
 
-  col = getFromRGBA(cspec_.buttonColor);
+  col = cspec_.buttonColor;
   if (col.isValid())
     standardPalette_.setColor(QPalette::Button,col);
 
-  col = getFromRGBA(cspec_.lightColor);
+  col = cspec_.lightColor;
   if (col.isValid())
     standardPalette_.setColor(QPalette::Light,col);
-  col = getFromRGBA(cspec_.midLightColor);
+  col = cspec_.midLightColor;
   if (col.isValid())
     standardPalette_.setColor(QPalette::Midlight,col);
-  col = getFromRGBA(cspec_.darkColor);
+  col = cspec_.darkColor;
   if (col.isValid())
     standardPalette_.setColor(QPalette::Dark,col);
-  col = getFromRGBA(cspec_.midColor);
+  col = cspec_.midColor;
   if (col.isValid())
     standardPalette_.setColor(QPalette::Mid,col);
-  col = getFromRGBA(cspec_.shadowColor);
+  col = cspec_.shadowColor;
   if (col.isValid())
     standardPalette_.setColor(QPalette::Shadow,col);
 
-  col = getFromRGBA(cspec_.highlightColor);
+  col = cspec_.highlightColor;
   if (col.isValid())
   {
     standardPalette_.setColor(QPalette::Active,QPalette::Highlight,col);
     standardPalette_.setColor(QPalette::Disabled,QPalette::Highlight,col);
-    col1 = getFromRGBA(cspec_.inactiveHighlightColor);
+    col1 = cspec_.inactiveHighlightColor;
     if (col1.isValid() && col1 != col && hasInactiveness)
       standardPalette_.setColor(QPalette::Inactive,QPalette::Highlight,col1);
     else
@@ -1330,12 +1343,12 @@ QPalette Style::standardPalette() const
     }
   }
 
-  col = getFromRGBA(cspec_.tooltipBaseColor);
+  col = cspec_.tooltipBaseColor;
   if (col.isValid())
     standardPalette_.setColor(QPalette::ToolTipBase,col);
   else
   { // for backward compatibility
-    col = getFromRGBA(cspec_.tooltipTextColor);
+    col = cspec_.tooltipTextColor;
     if (col.isValid())
     {
       col1 = QColor(Qt::white);
@@ -1346,7 +1359,7 @@ QPalette Style::standardPalette() const
   }
 
   /* text colors */
-  col = getFromRGBA(cspec_.textColor);
+  col = cspec_.textColor;
   if (col.isValid())
   {
 #if (QT_VERSION >= QT_VERSION_CHECK(5,12,0))
@@ -1367,7 +1380,7 @@ QPalette Style::standardPalette() const
 #if (QT_VERSION >= QT_VERSION_CHECK(5,12,0))
     standardPalette_.setColor(QPalette::PlaceholderText,placeholderTextColor);
 #endif
-    col1 = getFromRGBA(cspec_.inactiveTextColor);
+    col1 = cspec_.inactiveTextColor;
     if (col1.isValid() && hasInactiveness)
     {
       if (hspec_.opaque_colors && col1.alpha() < 255)
@@ -1382,7 +1395,7 @@ QPalette Style::standardPalette() const
       standardPalette_.setColor(QPalette::Inactive,QPalette::Text,col);
   }
 
-  col = getFromRGBA(cspec_.windowTextColor);
+  col = cspec_.windowTextColor;
   if (col.isValid())
   {
     if (hspec_.opaque_colors && col.alpha() < 255)
@@ -1392,7 +1405,7 @@ QPalette Style::standardPalette() const
       col = overlayColor(winCol,col);
     }
     standardPalette_.setColor(QPalette::Active,QPalette::WindowText,col);
-    col1 = getFromRGBA(cspec_.inactiveWindowTextColor);
+    col1 = cspec_.inactiveWindowTextColor;
     if (col1.isValid() && hasInactiveness)
     {
       if (hspec_.opaque_colors && col1.alpha() < 255)
@@ -1407,7 +1420,7 @@ QPalette Style::standardPalette() const
       standardPalette_.setColor(QPalette::Inactive,QPalette::WindowText,col);
   }
 
-  col = getFromRGBA(cspec_.buttonTextColor);
+  col = cspec_.buttonTextColor;
   if (col.isValid())
   {
     opacifyColor(col);
@@ -1415,19 +1428,19 @@ QPalette Style::standardPalette() const
     standardPalette_.setColor(QPalette::Inactive,QPalette::ButtonText,col);
   }
 
-  col = getFromRGBA(cspec_.tooltipTextColor);
+  col = cspec_.tooltipTextColor;
   if (col.isValid())
   {
     opacifyColor(col);
     standardPalette_.setColor(QPalette::ToolTipText,col);
   }
 
-  col = getFromRGBA(cspec_.highlightTextColor);
+  col = cspec_.highlightTextColor;
   if (col.isValid())
   {
     opacifyColor(col);
     standardPalette_.setColor(QPalette::Active,QPalette::HighlightedText,col);
-    col1 = getFromRGBA(cspec_.inactiveHighlightTextColor);
+    col1 = cspec_.inactiveHighlightTextColor;
     if (col1.isValid() && hasInactiveness)
     {
       opacifyColor(col1);
@@ -1437,13 +1450,13 @@ QPalette Style::standardPalette() const
       standardPalette_.setColor(QPalette::Inactive,QPalette::HighlightedText,col);
   }
 
-  col = getFromRGBA(cspec_.linkColor);
+  col = cspec_.linkColor;
   if (col.isValid())
   {
     opacifyColor(col);
     standardPalette_.setColor(QPalette::Link,col);
   }
-  col = getFromRGBA(cspec_.linkVisitedColor);
+  col = cspec_.linkVisitedColor;
   if (col.isValid())
   {
     opacifyColor(col);
@@ -1451,7 +1464,7 @@ QPalette Style::standardPalette() const
   }
 
   /* disabled text */
-  col = getFromRGBA(cspec_.disabledTextColor);
+  col = cspec_.disabledTextColor;
   if (col.isValid())
   {
     opacifyColor(col);
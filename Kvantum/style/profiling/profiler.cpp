@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "profiler.h"
+#include <QCoreApplication>
+#include <QSocketNotifier>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QMetaEnum>
+#include <QStyle>
+#include <QFile>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+namespace Kvantum {
+
+bool Profiler::enabled_ = false;
+Profiler *Profiler::instance_ = nullptr;
+
+static int signalFd[2] = {-1, -1};
+/* the SIGUSR1 action of the application before ours */
+static struct sigaction oldUsr1Action;
+
+static void usr1Handler(int sig, siginfo_t *info, void *context)
+{
+  char c = 1;
+  /* only async-signal-safe calls here */
+  ssize_t res = ::write(signalFd[0], &c, sizeof(c));
+  Q_UNUSED(res);
+  /* the application may use SIGUSR1 too */
+  if (oldUsr1Action.sa_flags & SA_SIGINFO)
+  {
+    if (oldUsr1Action.sa_sigaction)
+      oldUsr1Action.sa_sigaction(sig, info, context);
+  }
+  else if (oldUsr1Action.sa_handler != SIG_DFL
+           && oldUsr1Action.sa_handler != SIG_IGN)
+  {
+    oldUsr1Action.sa_handler(sig);
+  }
+}
+
+void Profiler::init()
+{
+  static bool initialized = false;
+  if (initialized) return;
+  initialized = true;
+
+  QString file = QString::fromLocal8Bit(qgetenv("KVANTUM_PROFILE"));
+  if (file.isEmpty()) return;
+  file.replace(QLatin1String("%p"), QString::number(QCoreApplication::applicationPid()));
+
+  instance_ = new Profiler(file);
+  enabled_ = true;
+}
+
+Profiler::Profiler(const QString &file) :
+  QObject(),
+  file_(file),
+  signalNotifier_(nullptr)
+{
+  /* SIGUSR1 is forwarded to the event loop through a socket pair */
+  if (::socketpair(AF_UNIX, SOCK_STREAM, 0, signalFd) == 0)
+  {
+    signalNotifier_ = new QSocketNotifier(signalFd[1], QSocketNotifier::Read, this);
+    connect(signalNotifier_, &QSocketNotifier::activated, this, &Profiler::readSignal);
+    struct sigaction sa;
+    sa.sa_sigaction = usr1Handler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART | SA_SIGINFO;
+    sigaction(SIGUSR1, &sa, &oldUsr1Action);
+  }
+}
+
+void Profiler::readSignal()
+{
+  signalNotifier_->setEnabled(false);
+  char c;
+  if (::read(signalFd[1], &c, sizeof(c)) > 0)
+    dump();
+  signalNotifier_->setEnabled(true);
+}
+
+void Profiler::record(Category category, const QString &key, qint64 nsecs)
+{
+  call_stats &s = stats_[category][key]; // zero-initialized if new
+  ++s.calls;
+  s.nsecs += nsecs;
+}
+
+void Profiler::record(Category category, int key, qint64 nsecs)
+{
+  call_stats &s = enumStats_[category][key];
+  ++s.calls;
+  s.nsecs += nsecs;
+}
+
+void Profiler::dump()
+{
+  static const char *categoryNames[CategoryCount] = {
+    "drawPrimitive", "drawControl", "drawComplexControl",
+    "renderFrame", "renderInterior", "renderIndicator", "svgElement"
+  };
+  /* the QStyle enums of the draw methods */
+  static const char *enumNames[CategoryCount] = {
+    "PrimitiveElement", "ControlElement", "ComplexControl",
+    nullptr, nullptr, nullptr, nullptr
+  };
+
+  QJsonObject root;
+  for (int c = 0; c < CategoryCount; ++c)
+  {
+    QJsonArray entries;
+    QHash<QString, call_stats>::const_iterator it = stats_[c].constBegin();
+    for (; it != stats_[c].constEnd(); ++it)
+    {
+      QJsonObject entry;
+      entry.insert(QStringLiteral("name"), it.key());
+      entry.insert(QStringLiteral("calls"), static_cast<double>(it.value().calls));
+      entry.insert(QStringLiteral("usecs"), static_cast<double>(it.value().nsecs) / 1000);
+      entries.append(entry);
+    }
+    QMetaEnum metaEnum;
+    if (enumNames[c])
+    {
+      int index = QStyle::staticMetaObject.indexOfEnumerator(enumNames[c]);
+      if (index >= 0)
+        metaEnum = QStyle::staticMetaObject.enumerator(index);
+    }
+    QHash<int, call_stats>::const_iterator eit = enumStats_[c].constBegin();
+    for (; eit != enumStats_[c].constEnd(); ++eit)
+    {
+      QJsonObject entry;
+      const char *name = metaEnum.isValid() ? metaEnum.valueToKey(eit.key()) : nullptr;
+      entry.insert(QStringLiteral("name"), name ? QString::fromLatin1(name)
+                                                : QString::number(eit.key()));
+      entry.insert(QStringLiteral("calls"), static_cast<double>(eit.value().calls));
+      entry.insert(QStringLiteral("usecs"), static_cast<double>(eit.value().nsecs) / 1000);
+      entries.append(entry);
+    }
+    root.insert(QString::fromLatin1(categoryNames[c]), entries);
+  }
+  if (cacheStats_)
+    root.insert(QStringLiteral("caches"), cacheStats_());
+
+  QFile file(file_);
+  if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    file.write(QJsonDocument(root).toJson());
+}
+
+}
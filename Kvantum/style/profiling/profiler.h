@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <QObject>
+#include <QHash>
+#include <QString>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <functional>
+
+class QSocketNotifier;
+
+namespace Kvantum {
+
+/* Instrumentation of the hot paths of the style. It's enabled by setting
+   the environment variable KVANTUM_PROFILE to the path of a JSON file
+   ("%p" is replaced by the process ID). The numbers of calls and their
+   accumulated times (including nested calls) are written to the file
+   when the style is destroyed or the process receives SIGUSR1 (a SIGUSR1
+   handler of the application is still called). When disabled, each
+   measured call only checks a static flag. */
+class Profiler : public QObject
+{
+  Q_OBJECT
+
+  public:
+    enum Category {
+      DrawPrimitive,
+      DrawControl,
+      DrawComplexControl,
+      RenderFrame,
+      RenderInterior,
+      RenderIndicator,
+      SvgElement, // an element rendered or rasterized by QSvgRenderer
+      CategoryCount
+    };
+
+    /* Reads the environment variable (only once). */
+    static void init();
+    static bool isEnabled() {
+      return enabled_;
+    }
+    static Profiler *instance() {
+      return instance_;
+    }
+
+    void record(Category category, const QString &key, qint64 nsecs);
+    void record(Category category, int key, qint64 nsecs);
+    /* Sets the function that gives the statistics of caches. */
+    void setCacheStats(const std::function<QJsonObject()> &cacheStats) {
+      cacheStats_ = cacheStats;
+    }
+    /* Writes the collected data to the JSON file. */
+    void dump();
+
+  private slots:
+    void readSignal();
+
+  private:
+    Profiler(const QString &file);
+
+    typedef struct {
+      quint64 calls;
+      qint64 nsecs;
+    } call_stats;
+
+    static bool enabled_;
+    static Profiler *instance_;
+
+    QString file_;
+    QHash<QString, call_stats> stats_[CategoryCount];
+    QHash<int, call_stats> enumStats_[CategoryCount];
+    std::function<QJsonObject()> cacheStats_;
+    QSocketNotifier *signalNotifier_;
+};
+
+/* Measures the lifetime of a scope if profiling is enabled. */
+class ProfileScope
+{
+  public:
+    ProfileScope(Profiler::Category category, int key) :
+      active_(Profiler::isEnabled())
+    {
+      if (Q_UNLIKELY(active_))
+      {
+        category_ = category;
+        intKey_ = key;
+        timer_.start();
+      }
+    }
+    ProfileScope(Profiler::Category category, const QString &key) :
+      active_(Profiler::isEnabled())
+    {
+      if (Q_UNLIKELY(active_))
+      {
+        category_ = category;
+        intKey_ = -1;
+        key_ = key;
+        timer_.start();
+      }
+    }
+    ~ProfileScope()
+    {
+      if (Q_UNLIKELY(active_))
+      {
+        if (intKey_ >= 0)
+          Profiler::instance()->record(category_, intKey_, timer_.nsecsElapsed());
+        else
+          Profiler::instance()->record(category_, key_, timer_.nsecsElapsed());
+      }
+    }
+
+  private:
+    bool active_;
+    Profiler::Category category_;
+    int intKey_;
+    QString key_;
+    QElapsedTimer timer_;
+};
+
+}
+
+#endif
@@ -18,7 +18,6 @@
 #include "Kvantum.h"
 
 #include <QSvgRenderer>
-#include <QPixmapCache>
 #include <QPainter>
 #include <QApplication>
 
@@ -39,19 +38,37 @@ static inline void drawSvgElement(QSvgRenderer *renderer, QPainter *painter, QRe
   painter->drawPixmap(bounds,pixmap,pixmap.rect());
 }
 
-bool Style::renderElement(QPainter *painter,
-                          const QString &element,
-                          const QRect &bounds,
-                          int hsize, int vsize, // pattern sizes
-                          bool usePixmap // first make a QPixmap for drawing
-                         ) const
+int Style::elementId(const QString &element) const
 {
-  if (element.isEmpty() || !bounds.isValid() || painter->opacity() == 0)
-    return true;
+  QHash<const QString, int>::const_iterator it = elementIds_.constFind(element);
+  if (it != elementIds_.constEnd())
+    return it.value();
+
+  svg_element res;
+  res.resolved = false;
+  res.renderer = nullptr;
+  res.hasPattern = false;
+
+  int id = elementNames_.size();
+  elementNames_.append(element);
+  resolvedElements_.append(res);
+  elementIds_.insert(element, id);
+  return id;
+}
 
-  QSvgRenderer *renderer = nullptr;
-  QString _element(element);
+Style::svg_element Style::resolveElement(int id) const
+{
+  const svg_element &cached = resolvedElements_.at(id);
+  if (cached.resolved)
+    return cached;
+
+  svg_element res;
+  res.resolved = true;
+  res.renderer = nullptr;
+  res.hasPattern = false;
 
+  const QString &element = elementNames_.at(id);
+  QString _element(element);
   if (themeRndr_ && themeRndr_->isValid()
       && (themeRndr_->elementExists(_element)
           || themeRndr_->elementExists(_element.remove("-inactive"))
@@ -60,11 +77,11 @@ bool Style::renderElement(QPainter *painter,
                                                .replace("-pressed","-normal")
                                                .replace("-focused","-normal"))))
   {
-    renderer = themeRndr_;
+    res.renderer = themeRndr_->renderer(); // nullptr if QtSvg rejects the file
   }
   /* always use the default SVG image (which doesn't contain
      any object for the inactive state) as fallback */
-  else if (defaultRndr_ && defaultRndr_->isValid())
+  if (!res.renderer && defaultRndr_ && defaultRndr_->isValid())
   {
     _element = element;
     if (defaultRndr_->elementExists(_element.remove("-inactive"))
@@ -73,10 +90,204 @@ bool Style::renderElement(QPainter *painter,
                                                .replace("-pressed","-normal")
                                                .replace("-focused","-normal")))
     {
-      renderer = defaultRndr_;
+      res.renderer = defaultRndr_->renderer();
+    }
+  }
+
+  if (res.renderer)
+  {
+    res.element = _element;
+    res.hasPattern = res.renderer->elementExists(_element+"-pattern");
+  }
+
+  resolvedElements_[id] = res;
+  return res;
+}
+
+int Style::stateElementId(int id, int state) const
+{
+  if (id < 0) return -1; // no element
+  const int index = id*stateCount + stateIndex(state);
+  if (index >= stateElementIds_.size())
+  {
+    int oldSize = stateElementIds_.size();
+    stateElementIds_.resize(elementNames_.size()*stateCount);
+    for (int i = oldSize; i < stateElementIds_.size(); ++i)
+      stateElementIds_[i] = -1;
+  }
+  int res = stateElementIds_.at(index);
+  if (res < 0)
+  {
+    res = elementId(elementNames_.at(id) + QLatin1String("-") + stateName(state));
+    stateElementIds_[index] = res;
+  }
+  return res;
+}
+
+int Style::suffixElementId(int id, int suffix) const
+{
+  static const char *suffixes[SuffixCount] = {
+    "-separator", "-icon-separator", "-top", "-bottom", "-right"
+  };
+  if (id < 0) return -1; // no element
+  const int index = id*SuffixCount + suffix;
+  if (index >= suffixElementIds_.size())
+  {
+    int oldSize = suffixElementIds_.size();
+    suffixElementIds_.resize(elementNames_.size()*SuffixCount);
+    for (int i = oldSize; i < suffixElementIds_.size(); ++i)
+      suffixElementIds_[i] = -1;
+  }
+  int res = suffixElementIds_.at(index);
+  if (res < 0)
+  {
+    res = elementId(elementNames_.at(id) + QLatin1String(suffixes[suffix]));
+    suffixElementIds_[index] = res;
+  }
+  return res;
+}
+
+void Style::internFrameParts(frame_parts &parts, const QString &element) const
+{
+  static const char *suffixes[FP_Count] = {
+    "-top", "-bottom", "-left", "-right",
+    "-topleft", "-topright", "-bottomleft", "-bottomright",
+    "-top-leftjunct", "-top-rightjunct", "-bottom-leftjunct", "-bottom-rightjunct",
+    "-left-leftjunct", "-left-rightjunct", "-right-leftjunct", "-right-rightjunct",
+    ""
+  };
+  for (int i = 0; i < FP_Count; ++i)
+    parts.part[i] = elementId(element + QLatin1String(suffixes[i]));
+}
+
+int Style::frameElementsId(int id, const frame_spec &fspec) const
+{
+  const QPair<int,int> key(id, fspec.expansion > 0 ? fspec.expandedElementId : -1);
+  QHash<QPair<int,int>, int>::const_iterator it = frameElementIds_.constFind(key);
+  if (it != frameElementIds_.constEnd())
+    return it.value();
+
+  /* a copy because interning may reallocate the names */
+  const QString element = elementNames_.at(id);
+
+  frame_elements fe;
+  fe.hasExpanded = fe.hasBorder = fe.hasExpandedTop = false;
+
+  bool isInactive(false);
+  QString state;
+  QStringList list = element.split(QStringLiteral("-"));
+  int count = list.count();
+  if (count > 2 && list.at(count - 1) == "inactive")
+  {
+    state = "-" + list.at(count - 2);
+    isInactive = true;
+  }
+  else if (count > 1)
+  {
+    state = "-" + list.at(count - 1);
+    static const QStringList states = {QStringLiteral("-normal"), QStringLiteral("-focused"), QStringLiteral("-pressed"), QStringLiteral("-toggled"), QStringLiteral("-disabled")}; // the disabled state is for CE_ProgressBarContents
+    if (!states.contains(state))
+      state = QString();
+  }
+
+  // search for expanded frame element
+  QString realElement;
+  if (key.second < 0)
+    realElement = element;
+  else
+  {
+    realElement = elementNames_.at(key.second);
+    if (!state.isEmpty())
+    {
+      realElement += state;
+      if (isInactive)
+        realElement += "-inactive";
     }
+    else if (element.endsWith("-default")) // default button
+      realElement += "-default";
+    else if (element.endsWith("-focus")) // focus element
+      realElement += "-focus";
   }
+  fe.realElement = elementId(realElement);
+
+  QString borderElement(realElement), expandedElement(realElement);
+  if (themeRndr_ && themeRndr_->isValid())
+  {
+    /* still round the corners if the "expand-" element is found */
+    QString element0 = "expand-"+realElement;
+    fe.hasExpanded = themeRndr_->elementExists(element0.remove("-inactive"))
+                     // fall back to the normal state
+                     || (!state.isEmpty()
+                         && themeRndr_->elementExists(element0.replace(state,"-normal")));
+
+    element0 = "border-"+realElement;
+    if (themeRndr_->elementExists(element0.remove("-inactive")+"-top")
+        || (!state.isEmpty() && themeRndr_->elementExists(element0.replace(state,"-normal")+"-top")))
+    {
+      fe.hasBorder = true;
+      borderElement = element0;
+      if (isInactive)
+        borderElement += "-inactive";
+    }
+
+    element0 = "expand-"+realElement;
+    if (themeRndr_->elementExists(element0.remove("-inactive")+"-top")
+        || (!state.isEmpty() && themeRndr_->elementExists(element0.replace(state,"-normal")+"-top")))
+    {
+      fe.hasExpandedTop = true;
+      expandedElement = element0;
+      if (isInactive)
+        expandedElement += "-inactive";
+    }
+  }
+
+  internFrameParts(fe.element, element);
+  internFrameParts(fe.real, realElement);
+  internFrameParts(fe.border, borderElement);
+  internFrameParts(fe.expanded, expandedElement);
+
+  int id = frameElements_.size();
+  frameElements_.append(fe);
+  frameElementIds_.insert(key, id);
+  return id;
+}
+
+void Style::setSpecElement(frame_spec &fspec, const QString &element) const
+{
+  fspec.element = element;
+  fspec.elementId = element.isEmpty() ? -1 : elementId(element);
+}
+
+void Style::setSpecElement(interior_spec &ispec, const QString &element) const
+{
+  ispec.element = element;
+  ispec.elementId = element.isEmpty() ? -1 : elementId(element);
+}
+
+void Style::setSpecElement(indicator_spec &dspec, const QString &element) const
+{
+  dspec.element = element;
+  dspec.elementId = element.isEmpty() ? -1 : elementId(element);
+}
+
+bool Style::renderElement(QPainter *painter,
+                          int id, // interned element ID
+                          const QRect &bounds,
+                          int hsize, int vsize, // pattern sizes
+                          bool usePixmap // first make a QPixmap for drawing
+                         ) const
+{
+  if (id < 0) return false; // no element
+  if (!bounds.isValid() || painter->opacity() == 0)
+    return true;
+  if (elementNames_.at(id).isEmpty())
+    return true;
+
+  const svg_element svgElement = resolveElement(id);
+  QSvgRenderer *renderer = svgElement.renderer;
   if (!renderer) return false;
+  ProfileScope profileScope(Profiler::SvgElement,elementNames_.at(id));
+  QString _element(svgElement.element);
 
   qreal pixelRatio = qApp->devicePixelRatio();
   if (painter->device())
@@ -91,7 +302,7 @@ bool Style::renderElement(QPainter *painter,
 
   if (hsize < 0) // means no tiling pattern (for windows/dialogs)
   {
-    if (renderer->elementExists(_element+"-pattern"))
+    if (svgElement.hasPattern)
     {
       if (usePixmap)
         drawSvgElement(renderer,painter,bounds,_element,pixelRatio);
@@ -109,7 +320,7 @@ bool Style::renderElement(QPainter *painter,
   {
     /* draw the pattern over the background
        if a separate pattern element exists */
-    if (renderer->elementExists(_element+"-pattern"))
+    if (svgElement.hasPattern)
     {
       if (usePixmap)
         drawSvgElement(renderer,painter,bounds,_element,pixelRatio);
@@ -120,11 +331,12 @@ bool Style::renderElement(QPainter *painter,
 
     int width = hsize > 0 ? hsize : bounds.width();
     int height = vsize > 0 ? vsize : bounds.height();
-    QString str = QString("%1-%2-%3").arg(_element)
-                                     .arg(QString().setNum(width))
-                                     .arg(QString().setNum(height));
+    /* the tile is always made with the pixel ratio 1 and
+       the pattern element is found from the element ID */
+    const render_key key = {id, width, height, static_cast<qreal>(1),
+                            RenderCache::Pattern};
     QPixmap pixmap;
-    if (!QPixmapCache::find(str, &pixmap))
+    if (!renderCache_.find(key, &pixmap))
     {
       pixmap = QPixmap(width, height);
       pixmap.fill(QColor(Qt::transparent));
@@ -132,7 +344,7 @@ bool Style::renderElement(QPainter *painter,
       p.begin(&pixmap);
       renderer->render(&p,_element);
       p.end();
-      QPixmapCache::insert(str, pixmap);
+      renderCache_.insert(key, pixmap);
     }
     painter->drawTiledPixmap(bounds,pixmap);
   }
@@ -150,6 +362,108 @@ bool Style::renderElement(QPainter *painter,
   return true;
 }
 
+/* Can a pixmap be drawn with the given transformation
+   without being scaled or sheared? */
+static inline bool isRectilinear(const QTransform &m)
+{
+  if (m.type() <= QTransform::TxTranslate)
+    return true;
+  if (m.type() > QTransform::TxRotate)
+    return false;
+  return (qAbs(m.m11()) == 1 && qAbs(m.m22()) == 1 && m.m12() == 0 && m.m21() == 0)
+         || (m.m11() == 0 && m.m22() == 0 && qAbs(m.m12()) == 1 && qAbs(m.m21()) == 1);
+}
+
+/* larger frame parts (like the interiors of
+   expanded frames) are always rendered directly */
+static const int maxAtlasArea = 256*256;
+
+void Style::renderFramePart(QPainter *painter,
+                            int id, // interned element ID
+                            const QRect &bounds,
+                            int hsize, int vsize, // pattern sizes
+                            bool usePixmap // first make a QPixmap for drawing
+                           ) const
+{
+  if (hsize != 0 || vsize != 0 // pattern tiles are cached by renderElement()
+      || !bounds.isValid() || painter->opacity() == 0
+      || bounds.width()*bounds.height() > maxAtlasArea
+      || !isRectilinear(painter->worldTransform()))
+  {
+    renderElement(painter,id,bounds,hsize,vsize,usePixmap);
+    return;
+  }
+  if (elementNames_.at(id).isEmpty())
+    return;
+
+  const svg_element svgElement = resolveElement(id);
+  if (!svgElement.renderer) return;
+
+  qreal pixelRatio = qApp->devicePixelRatio();
+  if (painter->device())
+    pixelRatio = painter->device()->devicePixelRatioF();
+  pixelRatio = qMax(pixelRatio, static_cast<qreal>(1));
+
+  /* with a shared atlas, its tiles are drawn directly from the shared
+     memory and only the tiles that don't fit into it are cached here */
+  const QString &name = elementNames_.at(id);
+  bool useAtlas(sharedAtlas_ && sharedAtlas_->pixelRatio() == pixelRatio);
+  QImage image;
+  if (useAtlas)
+    image = sharedAtlas_->find(name, bounds.size());
+  QPixmap pixmap;
+  if (image.isNull())
+  {
+    const render_key key = {id, bounds.width(), bounds.height(), pixelRatio,
+                            RenderCache::FramePart};
+    if (!renderCache_.find(key, &pixmap))
+    {
+      ProfileScope profileScope(Profiler::SvgElement,name);
+      if (useAtlas)
+      {
+        QImage tile((QSizeF(bounds.size())*pixelRatio).toSize(),
+                    QImage::Format_ARGB32_Premultiplied);
+        tile.fill(Qt::transparent);
+        QPainter p;
+        p.begin(&tile);
+        svgElement.renderer->render(&p,svgElement.element);
+        p.end();
+        /* another process may have added the tile in the meantime */
+        sharedAtlas_->insert(name, tile);
+        image = sharedAtlas_->find(name, bounds.size());
+        if (image.isNull())
+        {
+          pixmap = QPixmap::fromImage(tile);
+          renderCache_.insert(key, pixmap);
+        }
+      }
+      else
+      {
+        pixmap = QPixmap((QSizeF(bounds.size())*pixelRatio).toSize());
+        pixmap.fill(QColor(Qt::transparent));
+        QPainter p;
+        p.begin(&pixmap);
+        svgElement.renderer->render(&p,svgElement.element);
+        p.end();
+        renderCache_.insert(key, pixmap);
+      }
+    }
+  }
+
+  bool smooth(static_cast<qreal>(qRound(pixelRatio)) != pixelRatio);
+  if (smooth)
+  { // as in renderElement()
+    painter->save();
+    painter->setRenderHint(QPainter::SmoothPixmapTransform);
+  }
+  if (!image.isNull())
+    painter->drawImage(bounds,image,image.rect());
+  else
+    painter->drawPixmap(bounds,pixmap,pixmap.rect());
+  if (smooth)
+    painter->restore();
+}
+
 void Style::renderSliderTick(QPainter *painter,
                              const QString &element,
                              const QRect &ticksRect,
@@ -171,14 +485,14 @@ void Style::renderSliderTick(QPainter *painter,
           || (_element.contains("-inactive")
               && themeRndr_->elementExists(_element.remove("-inactive")))))
   {
-    renderer = themeRndr_;
+    renderer = themeRndr_->renderer(); // nullptr if QtSvg rejects the file
   }
-  else if (defaultRndr_ && defaultRndr_->isValid()
-           && defaultRndr_->elementExists(_element.remove("-inactive")))
+  if (!renderer && defaultRndr_ && defaultRndr_->isValid()
+      && defaultRndr_->elementExists(_element.remove("-inactive")))
   {
-    renderer = defaultRndr_;
+    renderer = defaultRndr_->renderer();
   }
-  else
+  if (!renderer)
     return;
 
   if (interval < 1) return;
@@ -213,7 +527,8 @@ void Style::renderSliderTick(QPainter *painter,
 void Style::renderFrame(QPainter *painter,
                         const QRect &bounds, // frame bounds
                         frame_spec fspec, // frame spec
-                        const QString &element, // frame SVG element
+                        int element, // interned frame SVG element
+                        int state, // widget state to append to the element
                         int d, // distance of the attached tab from the edge
                         int l, // length of the attached tab
                         int f1, // width of tab's left frame
@@ -224,6 +539,10 @@ void Style::renderFrame(QPainter *painter,
                         bool drawBorder // draw a border with maximum rounding if possible
                        ) const
 {
+  if (element < 0) return; // the spec has no element
+  const int id = state == NoState ? element : stateElementId(element,state);
+  ProfileScope profileScope(Profiler::RenderFrame,elementNames_.at(id));
+
   if (!bounds.isValid() || !fspec.hasFrame || painter->opacity() == 0)
     return;
 
@@ -236,41 +555,10 @@ void Style::renderFrame(QPainter *painter,
 
   int Left = 0, Top = 0, Right = 0, Bottom = 0;
 
-  bool isInactive(false);
-  QString state;
-  QStringList list = element.split(QStringLiteral("-"));
-  int count = list.count();
-  if (count > 2 && list.at(count - 1) == "inactive")
-  {
-    state = "-" + list.at(count - 2);
-    isInactive = true;
-  }
-  else if (count > 1)
-  {
-    state = "-" + list.at(count - 1);
-    static const QStringList states = {QStringLiteral("-normal"), QStringLiteral("-focused"), QStringLiteral("-pressed"), QStringLiteral("-toggled"), QStringLiteral("-disabled")}; // the disabled state is for CE_ProgressBarContents
-    if (!states.contains(state))
-      state = QString();
-  }
-
-  // search for expanded frame element
-  QString realElement = fspec.expandedElement;
-  if (fspec.expansion <= 0 || realElement.isEmpty())
-    realElement = element;
-  else if (!state.isEmpty())
-  {
-    realElement += state;
-    if (isInactive)
-      realElement += "-inactive";
-  }
-  else if (element.endsWith("-default")) // default button
-    realElement += "-default";
-  else if (element.endsWith("-focus")) // focus element
-    realElement += "-focus";
-
-  QString element1(realElement); // the element that will be drawn
-  QString element0(realElement); // used just for checking
-  element0 = "expand-"+element0;
+  /* the state, expanded element and existing elements are
+     found only once for each frame element (see frameElementsId) */
+  const frame_elements fe = frameElements_.at(frameElementsId(id, fspec));
+  const int *part = fe.real.part; // parts of the element that will be drawn
   bool isHAttached(fspec.isAttached && fspec.HPos != 2);
   if (isHAttached)
     grouped = true;
@@ -283,11 +571,7 @@ void Style::renderFrame(QPainter *painter,
   /* still round the corners if the "expand-" element is found */
   if (fspec.expansion > 0
       && ((e <= fspec.expansion && (isHAttached ? 2*w >= h : (!grouped || w >= h)))
-          || (themeRndr_ && themeRndr_->isValid()
-              && (themeRndr_->elementExists(element0.remove("-inactive"))
-                  // fall back to the normal state
-                  || (!state.isEmpty()
-                      && themeRndr_->elementExists(element0.replace(state,"-normal")))))))
+          || fe.hasExpanded))
   {
     drawExpanded = true; // can change below
     fspec.left = fspec.leftExpanded;
@@ -302,33 +586,16 @@ void Style::renderFrame(QPainter *painter,
           || fspec.expansion < 2*qMin(h,w)))
   {
     bool topElementMissing(!drawBorder);
-    /* find the element that should be drawn (element1) */
-    element0 = "border-"+realElement;
-    if (drawBorder && themeRndr_ && themeRndr_->isValid()
-        && (themeRndr_->elementExists(element0.remove("-inactive")+"-top")
-            || (!state.isEmpty() && themeRndr_->elementExists(element0.replace(state,"-normal")+"-top"))))
-    {
-      element1 = element0;
-      if (isInactive)
-        element1 = element1 + "-inactive";
-    }
+    /* find the element that should be drawn */
+    if (drawBorder && fe.hasBorder)
+      part = fe.border.part;
     else
     {
-      element0 = "expand-"+realElement;
-      if (themeRndr_ && themeRndr_->isValid()
-          && (themeRndr_->elementExists(element0.remove("-inactive")+"-top")
-              || (!state.isEmpty() && themeRndr_->elementExists(element0.replace(state,"-normal")+"-top"))))
-      {
-        element1 = element0;
-        if (isInactive)
-          element1 = element1 + "-inactive";
-        drawBorder = false;
-      }
+      if (fe.hasExpandedTop)
+        part = fe.expanded.part;
       else
-      {
-        drawBorder = false; // don't waste CPU time
-        topElementMissing = true;
-      }
+        topElementMissing = true; // don't waste CPU time
+      drawBorder = false;
     }
 
     /* find the main sizes for drawing expanded frames */
@@ -349,7 +616,7 @@ void Style::renderFrame(QPainter *painter,
         m.rotate(90);
         painter->save();
         painter->setTransform(m, true);
-        renderFrame(painter,r,fspec,realElement,d,l,f1,f2,tp,grouped,usePixmap);
+        renderFrame(painter,r,fspec,fe.realElement,NoState,d,l,f1,f2,tp,grouped,usePixmap);
         painter->restore();
         return;
       }
@@ -384,7 +651,7 @@ void Style::renderFrame(QPainter *painter,
   }
   else
   {
-    element1 = element;
+    part = fe.element.part;
     drawBorder = false;
     drawExpanded = false;
     Left = fspec.left;
@@ -456,209 +723,209 @@ void Style::renderFrame(QPainter *painter,
      *********/
     if (l > 0 && tp == QTabWidget::North)
     {
-      renderElement(painter,element1+"-top",
-                    QRect(x0+Left,
-                          y0,
-                          d-x0-Left,
-                          Top),
-                    fspec.ps,0,usePixmap);
-      renderElement(painter,element1+"-top",
-                    QRect(d+l,
-                          y0,
-                          x0+w-Left-d-l,
-                          Top),
-                    fspec.ps,0,usePixmap);
-     /* left and right junctions */
-     if (d-x0-Left >= 0)
-       renderElement(painter,element1+"-top-leftjunct",
-                      QRect(d,
+      renderFramePart(painter,part[FP_Top],
+                      QRect(x0+Left,
                             y0,
-                            f1,
+                            d-x0-Left,
                             Top),
-                      0,0,usePixmap);
-     if (x0+w-Left-d-l >= 0)
-       renderElement(painter,element1+"-top-rightjunct",
-                      QRect(d+l-f2,
+                      fspec.ps,0,usePixmap);
+      renderFramePart(painter,part[FP_Top],
+                      QRect(d+l,
                             y0,
-                            f2,
+                            x0+w-Left-d-l,
                             Top),
-                      0,0,usePixmap);
+                      fspec.ps,0,usePixmap);
+     /* left and right junctions */
+     if (d-x0-Left >= 0)
+       renderFramePart(painter,part[FP_TopLeftJunct],
+                        QRect(d,
+                              y0,
+                              f1,
+                              Top),
+                        0,0,usePixmap);
+     if (x0+w-Left-d-l >= 0)
+       renderFramePart(painter,part[FP_TopRightJunct],
+                        QRect(d+l-f2,
+                              y0,
+                              f2,
+                              Top),
+                        0,0,usePixmap);
     }
     else
-      renderElement(painter,element1+"-top",
-                    QRect(x0+Left,y0,w-Left-Right,Top),
-                    fspec.ps,0,usePixmap);
+      renderFramePart(painter,part[FP_Top],
+                      QRect(x0+Left,y0,w-Left-Right,Top),
+                      fspec.ps,0,usePixmap);
 
     /************
      ** Bottom **
      ************/
     if (l > 0 && tp == QTabWidget::South)
     {
-      renderElement(painter,element1+"-bottom",
-                    QRect(x0+Left,
-                          y1-Bottom,
-                          d-x0-Left,
-                          Bottom),
-                    fspec.ps,0,usePixmap);
-      renderElement(painter,element1+"-bottom",
-                    QRect(d+l,
-                          y1-Bottom,
-                          x0+w-Left-d-l,
-                          Bottom),
-                    fspec.ps,0,usePixmap);
-      if (d-x0-Left >= 0)
-        renderElement(painter,element1+"-bottom-leftjunct",
-                      QRect(d,
+      renderFramePart(painter,part[FP_Bottom],
+                      QRect(x0+Left,
                             y1-Bottom,
-                            f2,
+                            d-x0-Left,
                             Bottom),
-                      0,0,usePixmap);
-      if (x0+w-Left-d-l >= 0)
-        renderElement(painter,element1+"-bottom-rightjunct",
-                      QRect(d+l-f1,
+                      fspec.ps,0,usePixmap);
+      renderFramePart(painter,part[FP_Bottom],
+                      QRect(d+l,
                             y1-Bottom,
-                            f1,
+                            x0+w-Left-d-l,
                             Bottom),
-                      0,0,usePixmap);
+                      fspec.ps,0,usePixmap);
+      if (d-x0-Left >= 0)
+        renderFramePart(painter,part[FP_BottomLeftJunct],
+                        QRect(d,
+                              y1-Bottom,
+                              f2,
+                              Bottom),
+                        0,0,usePixmap);
+      if (x0+w-Left-d-l >= 0)
+        renderFramePart(painter,part[FP_BottomRightJunct],
+                        QRect(d+l-f1,
+                              y1-Bottom,
+                              f1,
+                              Bottom),
+                        0,0,usePixmap);
     }
     else
-      renderElement(painter,element1+"-bottom",
-                    QRect(x0+Left,y1-Bottom,w-Left-Right,Bottom),
-                    fspec.ps,0,usePixmap);
+      renderFramePart(painter,part[FP_Bottom],
+                      QRect(x0+Left,y1-Bottom,w-Left-Right,Bottom),
+                      fspec.ps,0,usePixmap);
 
     /**********
      ** Left **
      **********/
     if (l > 0 && tp == QTabWidget::West)
     {
-      renderElement(painter,element1+"-left",
-                    QRect(x0,
-                          y0+Top,
-                          Left,
-                          d-y0-Top),
-                    0,fspec.ps,usePixmap);
-      renderElement(painter,element1+"-left",
-                    QRect(x0,
-                          d+l,
-                          Left,
-                          y0+h-Bottom-d-l),
-                    0,fspec.ps,usePixmap);
-      if (y0+h-Bottom-d-l >= 0)
-        renderElement(painter,element1+"-left-leftjunct",
+      renderFramePart(painter,part[FP_Left],
                       QRect(x0,
-                            d+l-f2,
+                            y0+Top,
                             Left,
-                            f2),
-                      0,0,usePixmap);
-      if (d-y0-Top >= 0)
-        renderElement(painter,element1+"-left-rightjunct",
+                            d-y0-Top),
+                      0,fspec.ps,usePixmap);
+      renderFramePart(painter,part[FP_Left],
                       QRect(x0,
-                            d,
+                            d+l,
                             Left,
-                            f1),
-                      0,0,usePixmap);
+                            y0+h-Bottom-d-l),
+                      0,fspec.ps,usePixmap);
+      if (y0+h-Bottom-d-l >= 0)
+        renderFramePart(painter,part[FP_LeftLeftJunct],
+                        QRect(x0,
+                              d+l-f2,
+                              Left,
+                              f2),
+                        0,0,usePixmap);
+      if (d-y0-Top >= 0)
+        renderFramePart(painter,part[FP_LeftRightJunct],
+                        QRect(x0,
+                              d,
+                              Left,
+                              f1),
+                        0,0,usePixmap);
     }
     else
-      renderElement(painter,element1+"-left",
-                    QRect(x0,y0+Top,Left,h-Top-Bottom),
-                    0,fspec.ps,usePixmap);
+      renderFramePart(painter,part[FP_Left],
+                      QRect(x0,y0+Top,Left,h-Top-Bottom),
+                      0,fspec.ps,usePixmap);
 
     /***********
      ** Right **
      ***********/
     if (l > 0 && tp == QTabWidget::East)
     {
-      renderElement(painter,element1+"-right",
-                    QRect(x1-Right,
-                          y0+Top,
-                          Right,
-                          d-y0-Top),
-                    0,fspec.ps,usePixmap);
-      renderElement(painter,element1+"-right",
-                    QRect(x1-Right,
-                          d+l,
-                          Right,
-                          y0+h-Bottom-d-l),
-                    0,fspec.ps,usePixmap);
-      if (d-y0-Top >= 0)
-        renderElement(painter,element1+"-right-leftjunct",
+      renderFramePart(painter,part[FP_Right],
                       QRect(x1-Right,
-                            d,
+                            y0+Top,
                             Right,
-                            f1),
-                      0,0,usePixmap);
-      if (y0+h-Bottom-d-l >= 0)
-        renderElement(painter,element1+"-right-rightjunct",
+                            d-y0-Top),
+                      0,fspec.ps,usePixmap);
+      renderFramePart(painter,part[FP_Right],
                       QRect(x1-Right,
-                            d+l-f2,
+                            d+l,
                             Right,
-                            f2),
-                      0,0,usePixmap);
+                            y0+h-Bottom-d-l),
+                      0,fspec.ps,usePixmap);
+      if (d-y0-Top >= 0)
+        renderFramePart(painter,part[FP_RightLeftJunct],
+                        QRect(x1-Right,
+                              d,
+                              Right,
+                              f1),
+                        0,0,usePixmap);
+      if (y0+h-Bottom-d-l >= 0)
+        renderFramePart(painter,part[FP_RightRightJunct],
+                        QRect(x1-Right,
+                              d+l-f2,
+                              Right,
+                              f2),
+                        0,0,usePixmap);
     }
     else
-      renderElement(painter,element1+"-right",
-                    QRect(x1-Right,y0+Top,Right,h-Top-Bottom),
-                    0,fspec.ps,usePixmap);
+      renderFramePart(painter,part[FP_Right],
+                      QRect(x1-Right,y0+Top,Right,h-Top-Bottom),
+                      0,fspec.ps,usePixmap);
 
     /*************
      ** Topleft **
      *************/
-    QString  _element = element1+"-topleft";
+    int _element = part[FP_TopLeft];
     if (l > 0)
     {
       if (tp == QTabWidget::North && d < Left)
-        _element = element1+"-left";
+        _element = part[FP_Left];
       else if (tp == QTabWidget::West && d < Top)
-        _element = element1+"-top";
+        _element = part[FP_Top];
     }
-    renderElement(painter,_element,
-                  QRect(x0,y0,Left,Top),
-                  0,0,usePixmap);
+    renderFramePart(painter,_element,
+                    QRect(x0,y0,Left,Top),
+                    0,0,usePixmap);
 
     /**************
      ** Topright **
      **************/
-    _element = element1+"-topright";
+    _element = part[FP_TopRight];
     if (l > 0)
     {
       if (tp == QTabWidget::North && w-d-l < Right)
-        _element = element1+"-right";
+        _element = part[FP_Right];
       else if (tp == QTabWidget::East && d < Top)
-        _element = element1+"-top";
+        _element = part[FP_Top];
     }
-    renderElement(painter,_element,
-                  QRect(x1-Right,y0,Right,Top),
-                  0,0,usePixmap);
+    renderFramePart(painter,_element,
+                    QRect(x1-Right,y0,Right,Top),
+                    0,0,usePixmap);
 
     /****************
      ** Bottomleft **
      ****************/
-    _element = element1+"-bottomleft";
+    _element = part[FP_BottomLeft];
     if (l > 0)
     {
       if (tp == QTabWidget::South && d < Left)
-        _element = element1+"-left";
+        _element = part[FP_Left];
       else if (tp == QTabWidget::West && h-d-l < Bottom)
-        _element = element1+"-bottom";
+        _element = part[FP_Bottom];
     }
-    renderElement(painter,_element,
-                  QRect(x0,y1-Bottom,Left,Bottom),
-                  0,0,usePixmap);
+    renderFramePart(painter,_element,
+                    QRect(x0,y1-Bottom,Left,Bottom),
+                    0,0,usePixmap);
 
     /*****************
      ** Bottomright **
      *****************/
-    _element = element1+"-bottomright";
+    _element = part[FP_BottomRight];
     if (l > 0)
     {
       if (tp == QTabWidget::South && w-d-l < Right)
-        _element = element1+"-right";
+        _element = part[FP_Right];
       else if (tp == QTabWidget::East && h-d-l < Bottom)
-        _element = element1+"-bottom";
+        _element = part[FP_Bottom];
     }
-    renderElement(painter,_element,
-                  QRect(x1-Right,y1-Bottom,Right,Bottom),
-                  0,0,usePixmap);
+    renderFramePart(painter,_element,
+                    QRect(x1-Right,y1-Bottom,Right,Bottom),
+                    0,0,usePixmap);
   }
   else // with attachment
   {
@@ -681,20 +948,20 @@ void Style::renderFrame(QPainter *painter,
      *********/
     if (top > 0)
     {
-      renderElement(painter,element1+"-top",
-                    QRect(x0+left,y0,w-left-right,top),
-                    fspec.ps,0,usePixmap);
+      renderFramePart(painter,part[FP_Top],
+                      QRect(x0+left,y0,w-left-right,top),
+                      fspec.ps,0,usePixmap);
 
       // topleft corner
       if (left > 0)
-        renderElement(painter,element1+"-topleft",
-                      QRect(x0,y0,left,top),
-                      0,0,usePixmap);
+        renderFramePart(painter,part[FP_TopLeft],
+                        QRect(x0,y0,left,top),
+                        0,0,usePixmap);
       // topright corner
       if (right > 0)
-        renderElement(painter,element1+"-topright",
-                      QRect(x1-right,y0,right,top),
-                      0,0,usePixmap);
+        renderFramePart(painter,part[FP_TopRight],
+                        QRect(x1-right,y0,right,top),
+                        0,0,usePixmap);
     }
 
     /************
@@ -702,37 +969,37 @@ void Style::renderFrame(QPainter *painter,
      ************/
     if (bottom > 0)
     {
-      renderElement(painter,element1+"-bottom",
-                    QRect(x0+left,y1-bottom,w-left-right,bottom),
-                    fspec.ps,0,usePixmap);
+      renderFramePart(painter,part[FP_Bottom],
+                      QRect(x0+left,y1-bottom,w-left-right,bottom),
+                      fspec.ps,0,usePixmap);
 
       // bottomleft corner
       if (left > 0)
-        renderElement(painter,element1+"-bottomleft",
-                      QRect(x0,y1-bottom,left,bottom),
-                      0,0,usePixmap);
+        renderFramePart(painter,part[FP_BottomLeft],
+                        QRect(x0,y1-bottom,left,bottom),
+                        0,0,usePixmap);
       // bottomright corner
       if (right > 0)
-        renderElement(painter,element1+"-bottomright",
-                      QRect(x1-right,y1-bottom,right,bottom),
-                      0,0,usePixmap);
+        renderFramePart(painter,part[FP_BottomRight],
+                        QRect(x1-right,y1-bottom,right,bottom),
+                        0,0,usePixmap);
     }
 
     /**********
      ** Left **
      **********/
     if (left > 0)
-      renderElement(painter,element1+"-left",
-                    QRect(x0,y0+top,left,h-top-bottom),
-                    0,fspec.ps,usePixmap);
+      renderFramePart(painter,part[FP_Left],
+                      QRect(x0,y0+top,left,h-top-bottom),
+                      0,fspec.ps,usePixmap);
 
     /***********
      ** Right **
      ***********/
     if (right > 0)
-      renderElement(painter,element1+"-right",
-                    QRect(x1-right,y0+top,right,h-top-bottom),
-                    0,fspec.ps,usePixmap);
+      renderFramePart(painter,part[FP_Right],
+                      QRect(x1-right,y0+top,right,h-top-bottom),
+                      0,fspec.ps,usePixmap);
   }
 
 
@@ -747,9 +1014,9 @@ void Style::renderFrame(QPainter *painter,
       else if (fspec.HPos == 1)
         Left = 0;
     }
-    renderElement(painter,element1,
-                  bounds.adjusted(Left,Top,-Right,-Bottom),
-                  0,0,usePixmap);
+    renderFramePart(painter,part[FP_Center],
+                    bounds.adjusted(Left,Top,-Right,-Bottom),
+                    0,0,usePixmap);
   }
   if (drawBorder) // draw inside this rectangle to make a border
   {
@@ -762,7 +1029,7 @@ void Style::renderFrame(QPainter *painter,
                                 fspec.top,
                                 (fspec.isAttached && (fspec.HPos == -1 || fspec.HPos == 0)) ?  0: -fspec.right,
                                 -fspec.bottom),
-                Fspec,element,d,l,f1,f2,tp,grouped,usePixmap,false); // this time, don't draw any border
+                Fspec,id,NoState,d,l,f1,f2,tp,grouped,usePixmap,false); // this time, don't draw any border
   }
 }
 
@@ -770,34 +1037,53 @@ bool Style::renderInterior(QPainter *painter,
                            const QRect &bounds, // frame bounds
                            const frame_spec &fspec, // frame spec
                            const interior_spec &ispec, // interior spec
-                           const QString &element, // interior SVG element
+                           int element, // interned interior SVG element
+                           int state, // widget state to append to the element
                            bool grouped, // is among grouped similar widgets?
                            bool usePixmap // first make a QPixmap for drawing
                           ) const
 {
+  if (element < 0) return false; // the spec has no element
+  const int id = state == NoState ? element : stateElementId(element,state);
+  ProfileScope profileScope(Profiler::RenderInterior,elementNames_.at(id));
+
   if (!bounds.isValid() || !ispec.hasInterior || painter->opacity() == 0)
     return false;
 
   int w = bounds.width(); int h = bounds.height();
-  if (/*!isLibreoffice_ &&*/ fspec.expansion > 0 && !ispec.element.isEmpty())
+  if (/*!isLibreoffice_ &&*/ fspec.expansion > 0 && ispec.elementId >= 0)
   {
     bool isHAttached(fspec.isAttached && fspec.HPos != 2);
     if (isHAttached)
       grouped = true;
     int e = grouped ? h : qMin(h,w);
-    QString frameElement(fspec.expandedElement);
-    if (frameElement.isEmpty())
-      frameElement = fspec.element;
-    QString element0(element);
-    /* the interior used for partial frame expansion has the frame name */
-    element0 = element0.remove("-inactive").replace(ispec.element, frameElement);
-    element0 = "expand-"+element0;
+    const QPair<int,QPair<int,int> > key(id,
+                                         qMakePair(ispec.elementId,
+                                                   fspec.expandedElementId >= 0
+                                                     ? fspec.expandedElementId : fspec.elementId));
+    bool hasExpanded;
+    QHash<QPair<int,QPair<int,int> >, bool>::const_iterator it
+      = expandedInteriors_.constFind(key);
+    if (it != expandedInteriors_.constEnd())
+      hasExpanded = it.value();
+    else
+    {
+      QString frameElement(fspec.expandedElement);
+      if (frameElement.isEmpty())
+        frameElement = fspec.element;
+      QString element0(elementNames_.at(id));
+      /* the interior used for partial frame expansion has the frame name */
+      element0 = element0.remove("-inactive").replace(ispec.element, frameElement);
+      element0 = "expand-"+element0;
+      hasExpanded = themeRndr_ && themeRndr_->isValid()
+                    && (themeRndr_->elementExists(element0)
+                        || themeRndr_->elementExists(element0.replace("-toggled","-normal")
+                                                             .replace("-pressed","-normal")
+                                                             .replace("-focused","-normal")));
+      expandedInteriors_.insert(key, hasExpanded);
+    }
     if (((e <= fspec.expansion && (isHAttached ? 2*w >= h : (!grouped || w >= h)))
-         || (themeRndr_ && themeRndr_->isValid()
-             && (themeRndr_->elementExists(element0)
-                 || themeRndr_->elementExists(element0.replace("-toggled","-normal")
-                                                      .replace("-pressed","-normal")
-                                                      .replace("-focused","-normal")))))
+         || hasExpanded)
         && (!fspec.isAttached || fspec.VPos == 2)
         && (h <= 2*w || (fspec.HPos != 1 && fspec.HPos != -1)
             || fspec.expansion < 2*qMin(h,w)))
@@ -816,7 +1102,7 @@ bool Style::renderInterior(QPainter *painter,
       return false;
   }
 
-  return renderElement(painter,element,interiorRect(bounds,fspec),
+  return renderElement(painter,id,interiorRect(bounds,fspec),
                        ispec.px,ispec.py,usePixmap);
 }
 
@@ -824,11 +1110,16 @@ bool Style::renderIndicator(QPainter *painter,
                             const QRect &bounds, // frame bounds
                             const frame_spec &fspec, // frame spec
                             const indicator_spec &dspec, // indicator spec
-                            const QString &element, // indicator SVG element
+                            int element, // interned indicator SVG element
+                            int state, // widget state to append to the element
                             Qt::LayoutDirection ld,
                             Qt::Alignment alignment,
                             int vOffset) const
 {
+  if (element < 0) return false; // the spec has no element
+  const int id = state == NoState ? element : stateElementId(element,state);
+  ProfileScope profileScope(Profiler::RenderIndicator,elementNames_.at(id));
+
   if (!bounds.isValid()) return true;
   QRect interior = interiorRect(bounds,fspec);
   int s;
@@ -842,10 +1133,160 @@ bool Style::renderIndicator(QPainter *painter,
   if (interior.height() - s >= vOffset)
     interior.adjust(0,-vOffset,0,-vOffset);
 
-  return renderElement(painter,element,
+  return renderElement(painter,id,
                        alignedRect(ld,alignment,QSize(s,s),interior));
 }
 
+void Style::renderAnimatedPanel(QPainter *painter,
+                                const QWidget *widget,
+                                const QRect &bounds,
+                                const frame_spec &fspec,
+                                const interior_spec &ispec,
+                                int state,
+                                bool drawInterior,
+                                bool grouped) const
+{
+  if (!bounds.isValid()) return;
+
+  /* a scaled pixmap would be blurry */
+  if (!isRectilinear(painter->worldTransform()))
+  {
+    renderFrame(painter,bounds,fspec,fspec.elementId,state,0,0,0,0,0,grouped);
+    if (drawInterior)
+      renderInterior(painter,bounds,fspec,ispec,ispec.elementId,state,grouped);
+    return;
+  }
+
+  qreal pixelRatio = qApp->devicePixelRatio();
+  if (painter->device())
+    pixelRatio = painter->device()->devicePixelRatioF();
+  pixelRatio = qMax(pixelRatio, static_cast<qreal>(1));
+
+  animation_frame_key key;
+  key.widget = widget;
+  key.frameElement = stateElementId(fspec.elementId,state);
+  key.interiorElement = drawInterior ? stateElementId(ispec.elementId,state) : -1;
+  key.size = bounds.size();
+  key.pixelRatio = pixelRatio;
+  key.grouped = grouped;
+  key.top = fspec.top;
+  key.bottom = fspec.bottom;
+  key.left = fspec.left;
+  key.right = fspec.right;
+  key.expansion = fspec.expansion;
+  key.isAttached = fspec.isAttached;
+  key.HPos = fspec.HPos;
+  key.VPos = fspec.VPos;
+
+  QPixmap pixmap;
+  if (QPixmap *cached = animationFrames_.object(key))
+    pixmap = *cached;
+  else
+  {
+    pixmap = QPixmap((QSizeF(bounds.size())*pixelRatio).toSize());
+    pixmap.setDevicePixelRatio(pixelRatio);
+    pixmap.fill(Qt::transparent);
+    QPainter p(&pixmap);
+    const QRect r(QPoint(0,0), bounds.size());
+    renderFrame(&p,r,fspec,fspec.elementId,state,0,0,0,0,0,grouped);
+    if (drawInterior)
+      renderInterior(&p,r,fspec,ispec,ispec.elementId,state,grouped);
+    p.end();
+    animationFrames_.insert(key, new QPixmap(pixmap),
+                            qMax(1, pixmap.width()*pixmap.height()*pixmap.depth()/(8*1024)));
+  }
+  painter->drawPixmap(bounds.topLeft(), pixmap);
+}
+
+void Style::drawLabelShadow(QPainter *painter,
+                            const QRect &rtext,
+                            int talign,
+                            const QString &text,
+                            const QColor &shadowColor,
+                            qreal opacity, // the painter opacity of all shadow passes
+                            const label_spec &lspec) const
+{
+  if (lspec.depth <= 0 || !rtext.isValid())
+    return;
+
+  /* an unclipped text may go outside the pixmap and
+     a scaled pixmap would be blurry */
+  if ((talign & Qt::TextDontClip) || !isRectilinear(painter->worldTransform()))
+  {
+    painter->save();
+    painter->setOpacity(opacity);
+    painter->setPen(shadowColor);
+    for (int i=0; i<lspec.depth; i++)
+    {
+      int xShift = lspec.xshift + i * (lspec.xshift < 0 ? -1 : 1);
+      int yShift = lspec.yshift + i * (lspec.yshift < 0 ? -1 : 1);
+      painter->drawText(rtext.adjusted(xShift,yShift,xShift,yShift),
+                        talign,text);
+    }
+    painter->restore();
+    return;
+  }
+
+  /* the extent of all passes relative to the text rect */
+  int sx = lspec.xshift < 0 ? -1 : 1;
+  int sy = lspec.yshift < 0 ? -1 : 1;
+  int lastX = lspec.xshift + (lspec.depth-1) * sx;
+  int lastY = lspec.yshift + (lspec.depth-1) * sy;
+  int minX = qMin(lspec.xshift, lastX), maxX = qMax(lspec.xshift, lastX);
+  int minY = qMin(lspec.yshift, lastY), maxY = qMax(lspec.yshift, lastY);
+
+  qreal pixelRatio = qApp->devicePixelRatio();
+  if (painter->device())
+    pixelRatio = painter->device()->devicePixelRatioF();
+  pixelRatio = qMax(pixelRatio, static_cast<qreal>(1));
+
+  label_shadow_key key;
+  key.font = painter->font();
+  key.text = text;
+  key.talign = talign;
+  key.size = rtext.size();
+  key.color = shadowColor.rgba();
+  key.opacity = opacity;
+  key.depth = lspec.depth;
+  key.xshift = lspec.xshift;
+  key.yshift = lspec.yshift;
+  key.pixelRatio = pixelRatio;
+  key.rtl = painter->layoutDirection() == Qt::RightToLeft;
+
+  QPixmap pixmap;
+  if (QPixmap *cached = labelShadows_.object(key))
+    pixmap = *cached;
+  else
+  {
+    QSize size(rtext.width() + maxX - minX, rtext.height() + maxY - minY);
+    pixmap = QPixmap((QSizeF(size)*pixelRatio).toSize());
+    pixmap.setDevicePixelRatio(pixelRatio);
+    pixmap.fill(Qt::transparent);
+    QPainter p(&pixmap);
+    p.setRenderHints(painter->renderHints());
+    p.setLayoutDirection(painter->layoutDirection());
+    p.setFont(painter->font());
+    p.setOpacity(opacity);
+    p.setPen(shadowColor);
+    /* the passes are composited as they would be on the widget */
+    for (int i=0; i<lspec.depth; i++)
+    {
+      int xShift = lspec.xshift + i * sx;
+      int yShift = lspec.yshift + i * sy;
+      p.drawText(QRect(QPoint(xShift - minX, yShift - minY), rtext.size()),
+                 talign,text);
+    }
+    p.end();
+    labelShadows_.insert(key, new QPixmap(pixmap),
+                         qMax(1, pixmap.width()*pixmap.height()*pixmap.depth()/(8*1024)));
+  }
+
+  painter->save();
+  painter->setOpacity(1.0); // it's applied to the pixmap
+  painter->drawPixmap(rtext.topLeft() + QPoint(minX, minY), pixmap);
+  painter->restore();
+}
+
 void Style::renderLabel(
                         const QStyleOption *option,
                         QPainter *painter,
@@ -1030,40 +1471,40 @@ void Style::renderLabel(
       painter->setFont(f);
     }
 
-    QColor normalColor = getFromRGBA(lspec.normalColor);
+    QColor normalColor = lspec.normalColor;
     if (state != 0 && !(isPlasma_ && tialign == Qt::ToolButtonIconOnly))
     {
       QColor txtCol;
       switch (state) {
         case 1:
           if (isInactive)
-            txtCol = getFromRGBA(lspec.normalInactiveColor);
+            txtCol = lspec.normalInactiveColor;
           if (!txtCol.isValid())
             txtCol = normalColor;
           break;
         case 2 :
           if (isInactive)
-            txtCol = getFromRGBA(lspec.focusInactiveColor);
+            txtCol = lspec.focusInactiveColor;
           if (!txtCol.isValid())
-            txtCol = getFromRGBA(lspec.focusColor);
+            txtCol = lspec.focusColor;
           break;
         case 3 :
           if (isInactive)
-            txtCol = getFromRGBA(lspec.pressInactiveColor);
+            txtCol = lspec.pressInactiveColor;
           if (!txtCol.isValid())
-            txtCol = getFromRGBA(lspec.pressColor);
+            txtCol = lspec.pressColor;
           break;
         case 4 :
           if (isInactive)
-            txtCol = getFromRGBA(lspec.toggleInactiveColor);
+            txtCol = lspec.toggleInactiveColor;
           if (!txtCol.isValid())
-            txtCol = getFromRGBA(lspec.toggleColor);
+            txtCol = lspec.toggleColor;
           break;
         default : // -1
           if (isInactive)
-            txtCol = getFromRGBA(cspec_.progressInactiveIndicatorTextColor);
+            txtCol = cspec_.progressInactiveIndicatorTextColor;
           if (!txtCol.isValid())
-            txtCol = getFromRGBA(cspec_.progressIndicatorTextColor);
+            txtCol = cspec_.progressIndicatorTextColor;
           break;
       }
 
@@ -1077,12 +1518,12 @@ void Style::renderLabel(
         QColor shadowColor;
         if (isInactive)
         {
-          shadowColor = getFromRGBA(lspec.inactiveShadowColor);
+          shadowColor = lspec.inactiveShadowColor;
           if (!shadowColor.isValid())
-            shadowColor = getFromRGBA(lspec.shadowColor);
+            shadowColor = lspec.shadowColor;
         }
         else
-          shadowColor = getFromRGBA(lspec.shadowColor);
+          shadowColor = lspec.shadowColor;
 
         /* the shadow should have enough contrast with the text */
         if (enoughContrast(txtCol, shadowColor))
@@ -1095,14 +1536,7 @@ void Style::renderLabel(
             painter->setOpacity(shadowColor.alphaF());
             shadowColor.setAlpha(255);
           }
-          painter->setPen(shadowColor);
-          for (int i=0; i<lspec.depth; i++)
-          {
-            int xShift = lspec.xshift + i * (lspec.xshift < 0 ? -1 : 1);
-            int yShift = lspec.yshift + i * (lspec.yshift < 0 ? -1 : 1);
-            painter->drawText(rtext.adjusted(xShift,yShift,xShift,yShift),
-                              talign,text);
-          }
+          drawLabelShadow(painter,rtext,talign,text,shadowColor,painter->opacity(),lspec);
           painter->restore();
         }
       }
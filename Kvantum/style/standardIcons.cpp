@@ -68,14 +68,14 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
             || isStylableToolbar(widget) // doesn't happen
             || mergedToolbarHeight(widget) > 0)
         {
-          col = getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor);
+          col = getLabelSpec(ToolbarClass).normalColor;
         }
         else if (widget)
-          col = getFromRGBA(getLabelSpec(QStringLiteral("MenuBar")).normalColor);
+          col = getLabelSpec(MenuBarClass).normalColor;
         if (enoughContrast(col, standardPalette().color(QPalette::Active,QPalette::WindowText))
             && themeRndr_->elementExists("flat-"+dspec.element+"-down-normal"))
         {
-          dspec.element = "flat-"+dspec.element;
+          setSpecElement(dspec, "flat-"+dspec.element);
         }
       }
 
@@ -103,10 +103,10 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
 
       if (!hspec_.single_top_toolbar
           && themeRndr_ && themeRndr_->isValid()
-          && enoughContrast(getFromRGBA(getLabelSpec(QStringLiteral("Toolbar")).normalColor),
+          && enoughContrast(getLabelSpec(ToolbarClass).normalColor,
                             standardPalette().color(QPalette::Active,QPalette::WindowText)))
       {
-        dspec.element = "flat-"+dspec.element;
+        setSpecElement(dspec, "flat-"+dspec.element);
       }
 
       if (renderElement(&painter, dspec.element+"-down-normal", QRect(0,0,s,s)))
@@ -175,8 +175,8 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
       /* no menu icon without enough contrast (see Qt ->
          qmdisubwindow.cpp -> QMdiSubWindowPrivate::createSystemMenu) */
       if (option == nullptr && qobject_cast<const QMdiSubWindow*>(widget)
-          && enoughContrast(getFromRGBA(getLabelSpec(QStringLiteral("MenuItem")).normalColor),
-                            getFromRGBA(getLabelSpec(QStringLiteral("TitleBar")).focusColor)))
+          && enoughContrast(getLabelSpec(MenuItemClass).normalColor,
+                            getLabelSpec(TitleBarClass).focusColor))
        return QIcon(pm);
 
       QPainter painter(&pm);
@@ -188,7 +188,7 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
                    (option->state & State_MouseOver) ? "focused" : "normal"
                  : "disabled";
       if (renderElement(&painter,
-                        getIndicatorSpec(QStringLiteral("TitleBar")).element+"-minimize-"+status,
+                        getIndicatorSpec(TitleBarClass).element+"-minimize-"+status,
                         QRect(0,0,s,s)))
         return QIcon(pm);
       else break;
@@ -203,13 +203,13 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
       pm.fill(Qt::transparent);
 
       if (option == nullptr && qobject_cast<const QMdiSubWindow*>(widget)
-          && enoughContrast(getFromRGBA(getLabelSpec(QStringLiteral("MenuItem")).normalColor),
-                            getFromRGBA(getLabelSpec(QStringLiteral("TitleBar")).focusColor)))
+          && enoughContrast(getLabelSpec(MenuItemClass).normalColor,
+                            getLabelSpec(TitleBarClass).focusColor))
        return QIcon(pm); // no menu icon without enough contrast
 
       QPainter painter(&pm);
 
-      if (renderElement(&painter,getIndicatorSpec(QStringLiteral("TitleBar")).element+"-maximize-normal",QRect(0,0,s,s)))
+      if (renderElement(&painter,getIndicatorSpec(TitleBarClass).element+"-maximize-normal",QRect(0,0,s,s)))
         return QIcon(pm);
       else break;
     }
@@ -225,8 +225,8 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
 
       if (standardIcon == SP_TitleBarCloseButton
           && option == nullptr && qobject_cast<const QMdiSubWindow*>(widget)
-          && enoughContrast(getFromRGBA(getLabelSpec(QStringLiteral("MenuItem")).normalColor),
-                            getFromRGBA(getLabelSpec(QStringLiteral("TitleBar")).focusColor)))
+          && enoughContrast(getLabelSpec(MenuItemClass).normalColor,
+                            getLabelSpec(TitleBarClass).focusColor))
        return QIcon(pm); // no menu icon without enough contrast
 
       QPainter painter(&pm);
@@ -249,7 +249,7 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
       }
       if (!rendered)
         rendered = renderElement(&painter,
-                                 getIndicatorSpec(QStringLiteral("TitleBar")).element+"-close-"+status,
+                                 getIndicatorSpec(TitleBarClass).element+"-close-"+status,
                                  QRect(0,0,s,s));
       if (rendered)
         return QIcon(pm);
@@ -266,7 +266,7 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
 
       QPainter painter(&pm);
 
-      if (renderElement(&painter,getIndicatorSpec(QStringLiteral("TitleBar")).element+"-menu-normal",QRect(0,0,s,s)))
+      if (renderElement(&painter,getIndicatorSpec(TitleBarClass).element+"-menu-normal",QRect(0,0,s,s)))
         return QIcon(pm);
       else break;
     }
@@ -280,8 +280,8 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
       pm.fill(Qt::transparent);
 
       if (option == nullptr && qobject_cast<const QMdiSubWindow*>(widget)
-          && enoughContrast(getFromRGBA(getLabelSpec(QStringLiteral("MenuItem")).normalColor),
-                            getFromRGBA(getLabelSpec(QStringLiteral("TitleBar")).focusColor)))
+          && enoughContrast(getLabelSpec(MenuItemClass).normalColor,
+                            getLabelSpec(TitleBarClass).focusColor))
        return QIcon(pm); // no menu icon without enough contrast
 
       QPainter painter(&pm);
@@ -301,7 +301,7 @@ QIcon Style::standardIcon(QStyle::StandardPixmap standardIcon,
                                  QRect(0,0,s,s));
       if (!rendered)
         rendered = renderElement(&painter,
-                                 getIndicatorSpec(QStringLiteral("TitleBar")).element+"-restore-"+status,
+                                 getIndicatorSpec(TitleBarClass).element+"-restore-"+status,
                                  QRect(0,0,s,s));
       if (rendered)
         return QIcon(pm);
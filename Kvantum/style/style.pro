@@ -39,13 +39,23 @@ greaterThan(QT_MAJOR_VERSION, 4) {
              drag/x11wmmove.cpp \
              drag/windowmanager.cpp \
              blur/blurhelper.cpp \
-             animation/animation.cpp
+             animation/animation.cpp \
+             animation/frameclock.cpp \
+             cache/rendercache.cpp \
+             cache/sharedatlas.cpp \
+             svg/lazysvgrenderer.cpp \
+             profiling/profiler.cpp
   HEADERS += Kvantum.h \
              KvantumPlugin.h \
              drag/x11wmmove.h \
              drag/windowmanager.h \
              blur/blurhelper.h \
-             animation/animation.h
+             animation/animation.h \
+             animation/frameclock.h \
+             cache/rendercache.h \
+             cache/sharedatlas.h \
+             svg/lazysvgrenderer.h \
+             profiling/profiler.h
   OTHER_FILES += kvantum.json
 } else {
   SOURCES += qt4/Kvantum4.cpp \
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "lazysvgrenderer.h"
+#include <QSvgRenderer>
+#include <QXmlStreamReader>
+#include <QFile>
+#include <QVector>
+
+namespace Kvantum {
+
+/* SVG elements that become nodes of the document in QtSvg (only
+   nodes can be found by QSvgRenderer::elementExists()), and those
+   among them whose children can be nodes too */
+static const char *containerTags[] = {"a", "defs", "g", "svg", "switch"};
+static const char *graphicsTags[] = {"animation", "circle", "ellipse", "image", "line",
+                                     "path", "polygon", "polyline", "rect", "text",
+                                     "textArea", "use"};
+
+static inline bool hasTag(const QStringRef &name, const char *const *tags, int count)
+{
+  for (int i = 0; i < count; ++i)
+  {
+    if (name == QLatin1String(tags[i]))
+      return true;
+  }
+  return false;
+}
+
+LazySvgRenderer::LazySvgRenderer(const QString &file) :
+  file_(file),
+  indexed_(false),
+  valid_(false),
+  renderer_(nullptr)
+{
+  indexed_ = indexElements();
+  if (!indexed_)
+  {
+    ids_.clear();
+    valid_ = true; // to be decided by QtSvg
+    renderer();
+  }
+}
+
+LazySvgRenderer::~LazySvgRenderer()
+{
+  delete renderer_;
+}
+
+bool LazySvgRenderer::indexElements()
+{
+  QFile file(file_);
+  if (!file.open(QIODevice::ReadOnly))
+  { // QSvgRenderer wouldn't read it either
+    valid_ = false;
+    return true;
+  }
+
+  QXmlStreamReader xml(&file);
+  /* whether each open element may have nodes as its children */
+  QVector<bool> containers;
+  bool root = true;
+  while (!xml.atEnd())
+  {
+    switch (xml.readNext()) {
+      case QXmlStreamReader::StartElement: {
+        const QStringRef name = xml.name();
+        if (root)
+        {
+          if (name != QLatin1String("svg"))
+            return false;
+          root = false;
+        }
+        bool parentIsContainer = containers.isEmpty() || containers.last();
+        bool isContainer = false;
+        if (parentIsContainer)
+        {
+          isContainer = hasTag(name, containerTags, sizeof(containerTags) / sizeof(containerTags[0]));
+          if (isContainer
+              || hasTag(name, graphicsTags, sizeof(graphicsTags) / sizeof(graphicsTags[0])))
+          {
+            const QStringRef id = xml.attributes().value(QLatin1String("id"));
+            if (!id.isEmpty())
+              ids_.insert(id.toString());
+          }
+        }
+        containers.append(isContainer);
+        break;
+      }
+      case QXmlStreamReader::EndElement:
+        if (!containers.isEmpty())
+          containers.removeLast();
+        break;
+      /* entities may add elements that we can't see */
+      case QXmlStreamReader::DTD:
+        if (!xml.entityDeclarations().isEmpty())
+          return false;
+        break;
+      case QXmlStreamReader::EntityReference:
+        return false;
+      default: break;
+    }
+  }
+  if (xml.hasError() || root)
+    return false;
+
+  valid_ = true;
+  return true;
+}
+
+bool LazySvgRenderer::elementExists(const QString &id) const
+{
+  if (!valid_)
+    return false;
+  if (!indexed_)
+    return renderer_->elementExists(id);
+  return ids_.contains(id);
+}
+
+QSvgRenderer *LazySvgRenderer::renderer() const
+{
+  if (!valid_)
+    return nullptr;
+  if (!renderer_)
+  {
+    renderer_ = new QSvgRenderer();
+    /* the file may be rejected by QtSvg although the scan succeeded */
+    if (!renderer_->load(file_))
+      valid_ = false;
+  }
+  return valid_ ? renderer_ : nullptr;
+}
+
+}
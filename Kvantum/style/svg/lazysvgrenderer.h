@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) Pedram Pourang (aka Tsu Jan) 2014-2019 <tsujan2000@gmail.com>
+ *
+ * Kvantum is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Kvantum is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LAZYSVGRENDERER_H
+#define LAZYSVGRENDERER_H
+
+#include <QSet>
+#include <QString>
+
+class QSvgRenderer;
+
+namespace Kvantum {
+
+/* A wrapper around QSvgRenderer that doesn't parse the SVG document until
+   an element should be rendered. Instead, the IDs of the elements that
+   QSvgRenderer would find are indexed by a fast scan of the file, so that
+   queries about the existence of elements and the validity of the file
+   don't need the document. If the file has anything that the scan can't
+   handle, it's parsed immediately.
+
+   A file is valid if the scan succeeds. Because QtSvg may still reject
+   it, the renderer becomes invalid if the document can't be loaded when
+   it's needed. Then renderer() returns nullptr and the caller should use
+   the default renderer instead. */
+class LazySvgRenderer
+{
+  public:
+    LazySvgRenderer(const QString &file);
+    ~LazySvgRenderer();
+
+    bool isValid() const {
+      return valid_;
+    }
+    bool elementExists(const QString &id) const;
+    /* Returns the real renderer, after parsing the file if needed,
+       or nullptr if QtSvg can't load the file. */
+    QSvgRenderer *renderer() const;
+
+  private:
+    /* Index the element IDs; returns false if it isn't possible. */
+    bool indexElements();
+
+    QString file_;
+    QSet<QString> ids_;
+    bool indexed_; // if false, the real renderer is asked
+    mutable bool valid_; // the result of the scan, and then of loading
+    mutable QSvgRenderer *renderer_;
+};
+
+}
+
+#endif
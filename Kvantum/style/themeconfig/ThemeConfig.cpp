@@ -18,6 +18,14 @@
 #include <QSettings>
 #include <QFile>
 #include <QApplication>
+#if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
+#include <QDir>
+#include <QFileInfo>
+#include <QDataStream>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QCryptographicHash>
+#endif
 #include "ThemeConfig.h"
 #if defined Q_WS_X11 || defined Q_OS_LINUX || defined Q_OS_FREEBSD || defined Q_OS_HURD
 #include <QX11Info>
@@ -31,8 +39,30 @@
 #endif
 
 namespace Kvantum {
+/* Qt >= 5.2 accepts #ARGB as the color name but most apps use #RGBA.
+   Here we get the alpha from #RGBA if it exists. */
+static spec_color getColor(const QVariant &v)
+{
+#if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
+  const QString str = v.toString();
+  if (str.size() == 9 && str.startsWith(QLatin1Char('#')))
+  {
+    bool ok;
+    int alpha = str.rightRef(2).toInt(&ok, 16);
+    if (ok)
+    {
+      QColor col(str.left(7));
+      col.setAlpha(alpha);
+      return col;
+    }
+  }
+  return QColor(str); // invalid if empty
+#else
+  return v.toString();
+#endif
+}
+
 ThemeConfig::ThemeConfig(const QString& theme) :
-  settings_(nullptr),
   parentConfig_(nullptr)
 {
   /* For now, the lack of x11 means wayland.
@@ -71,39 +101,125 @@ ThemeConfig::ThemeConfig(const QString& theme) :
 
 ThemeConfig::~ThemeConfig()
 {
-  if (settings_)
-    delete settings_;
 }
 
-void ThemeConfig::load(const QString& theme)
+#if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
+/* The compiled form of a theme config file is kept in the cache
+   directory, so that other processes don't need to parse it again.
+   Increase the version whenever the format changes. */
+static const quint32 kvcacheMagic = 0x4b564354; // "KVCT"
+static const quint32 kvcacheVersion = 1;
+
+static QString kvcachePath(const QString &theme)
+{
+  QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+  if (cacheDir.isEmpty())
+    return QString();
+  /* config files with the same name may exist in different folders */
+  QByteArray hash = QCryptographicHash::hash(theme.toUtf8(), QCryptographicHash::Md5).toHex();
+  return cacheDir + QStringLiteral("/Kvantum/") + QString::fromLatin1(hash) + QStringLiteral(".kvcache");
+}
+
+bool ThemeConfig::loadCache(const QString &cacheFile, const QFileInfo &source)
 {
-  if (settings_)
+  QFile file(cacheFile);
+  if (!file.open(QIODevice::ReadOnly))
+    return false;
+
+  /* the cache is small and all of it is needed, so it's read
+     sequentially and deserialized into the value tables */
+  QDataStream in(&file);
+  in.setVersion(QDataStream::Qt_5_0);
+  quint32 magic, version;
+  QString path;
+  qint64 mtime, fileSize;
+  in >> magic >> version;
+  bool ok(false);
+  if (in.status() == QDataStream::Ok
+      && magic == kvcacheMagic && version == kvcacheVersion)
   {
-    delete settings_;
-    settings_ = nullptr;
+    in >> path >> mtime >> fileSize;
+    /* the cache is stale if the config file is modified */
+    if (in.status() == QDataStream::Ok
+        && path == source.absoluteFilePath()
+        && mtime == source.lastModified().toMSecsSinceEpoch()
+        && fileSize == source.size())
+    {
+      in >> values_;
+      ok = (in.status() == QDataStream::Ok);
+    }
   }
+  if (!ok)
+    values_.clear();
+  return ok;
+}
 
-  if (!QFile::exists(theme))
+void ThemeConfig::saveCache(const QString &cacheFile, const QFileInfo &source) const
+{
+  if (!QDir().mkpath(QFileInfo(cacheFile).absolutePath()))
     return;
-
-  settings_ = new QSettings(theme,QSettings::NativeFormat);
+  QSaveFile file(cacheFile); // another process may be reading it
+  if (!file.open(QIODevice::WriteOnly))
+    return;
+  QDataStream out(&file);
+  out.setVersion(QDataStream::Qt_5_0);
+  out << kvcacheMagic << kvcacheVersion
+      << source.absoluteFilePath()
+      << static_cast<qint64>(source.lastModified().toMSecsSinceEpoch())
+      << static_cast<qint64>(source.size())
+      << values_;
+  if (out.status() == QDataStream::Ok)
+    file.commit();
+  else
+    file.cancelWriting();
 }
+#endif
 
-QVariant ThemeConfig::getValue(const QString& group, const QString& key) const
+void ThemeConfig::load(const QString& theme)
 {
-  QVariant r;
+  values_.clear();
 
-  if (group.isNull() || group.isEmpty() || key.isNull() || key.isEmpty())
-    return r;
+  if (!QFile::exists(theme))
+    return;
 
-  if (settings_)
+#if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
+  /* resources (the default theme) are always parsed */
+  QString cacheFile;
+  QFileInfo source(theme);
+  if (!theme.startsWith(QLatin1Char(':')))
   {
-    settings_->beginGroup(group);
-    r = settings_->value(key);
-    settings_->endGroup();
+    cacheFile = kvcachePath(source.absoluteFilePath());
+    if (!cacheFile.isEmpty() && loadCache(cacheFile, source))
+      return;
   }
+#endif
 
-  return r;
+  /* read all keys only once; QSettings::beginGroup(),
+     value() and endGroup() are much slower than a hash lookup */
+  QSettings settings(theme,QSettings::NativeFormat);
+  const QStringList keys = settings.allKeys();
+  for (const QString &key : keys)
+  {
+    int index = key.indexOf(QLatin1Char('/'));
+    if (index <= 0) continue; // top-level keys aren't used
+    values_[key.left(index)].insert(key.mid(index + 1), settings.value(key));
+  }
+
+#if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
+  if (!cacheFile.isEmpty())
+    saveCache(cacheFile, source);
+#endif
+}
+
+QVariant ThemeConfig::getValue(const QString& group, const QString& key) const
+{
+  if (group.isEmpty() || key.isEmpty())
+    return QVariant();
+
+  QHash<QString, QHash<QString, QVariant> >::const_iterator it = values_.constFind(group);
+  if (it == values_.constEnd())
+    return QVariant();
+  return it.value().value(key);
 }
 
 QVariant ThemeConfig::getValue(const QString& group, const QString& key, const QString &inherits) const
@@ -362,38 +478,38 @@ label_spec ThemeConfig::getLabelSpec(const QString &elementName)
     r.hasShadow = v.toBool();
 
     v = getValue(elementName,KSL("text.normal.color"), i);
-    r.normalColor = v.toString();
+    r.normalColor = getColor(v);
 
     v = getValue(elementName,KSL("text.normal.inactive.color"), i);
-    r.normalInactiveColor = v.toString();
+    r.normalInactiveColor = getColor(v);
 
     v = getValue(elementName,KSL("text.focus.color"), i);
-    r.focusColor = v.toString();
+    r.focusColor = getColor(v);
 
     v = getValue(elementName,KSL("text.focus.inactive.color"), i);
-    r.focusInactiveColor = v.toString();
+    r.focusInactiveColor = getColor(v);
 
     if (elementName == "MenuItem" || elementName == "MenuBarItem")
     { // no inheritance because the (fallback) focus color seems more natural
       v = getValue(elementName,KSL("text.press.color"));
-      r.pressColor = v.toString();
+      r.pressColor = getColor(v);
 
       v = getValue(elementName,KSL("text.toggle.color"));
-      r.toggleColor = v.toString();
+      r.toggleColor = getColor(v);
     }
     else
     {
       v = getValue(elementName,KSL("text.press.color"), i);
-      r.pressColor = v.toString();
+      r.pressColor = getColor(v);
 
       v = getValue(elementName,KSL("text.press.inactive.color"), i);
-      r.pressInactiveColor = v.toString();
+      r.pressInactiveColor = getColor(v);
 
       v = getValue(elementName,KSL("text.toggle.color"), i);
-      r.toggleColor = v.toString();
+      r.toggleColor = getColor(v);
 
       v = getValue(elementName,KSL("text.toggle.inactive.color"), i);
-      r.toggleInactiveColor = v.toString();
+      r.toggleInactiveColor = getColor(v);
     }
 
     /* because finding longest texts of combo boxes isn't CPU-friendly and since
@@ -445,10 +561,10 @@ label_spec ThemeConfig::getLabelSpec(const QString &elementName)
         r.yshift = v.toInt();
       v = getValue(elementName,KSL("text.shadow.color"), i);
       if (v.isValid())
-        r.shadowColor = v.toString();
+        r.shadowColor = getColor(v);
       v = getValue(elementName,KSL("text.inactive.shadow.color"), i);
       if (v.isValid())
-        r.inactiveShadowColor = v.toString();
+        r.inactiveShadowColor = getColor(v);
       v = getValue(elementName,KSL("text.shadow.alpha"), i);
       if (v.isValid())
         r.a = qMax(v.toInt(),0);
@@ -1014,6 +1130,14 @@ theme_spec ThemeConfig::getThemeSpec()
   v = getValue(KSL("General"),KSL("dark_titlebar"));
   r.dark_titlebar = v.toBool();
 
+  v = getValue(KSL("General"),KSL("render_cache_size"));
+  if (v.isValid()) // 16 by default
+    r.render_cache_size = qMin(qMax(v.toInt(),1), 256);
+
+  v = getValue(KSL("General"),KSL("animation_fps"));
+  if (v.isValid()) // 25 by default
+    r.animation_fps = qMin(qMax(v.toInt(),10), 120);
+
   return r;
 }
 
@@ -1023,89 +1147,89 @@ color_spec ThemeConfig::getColorSpec() const
   default_color_spec(r);
 
   QVariant v = getValue(KSL("GeneralColors"),KSL("window.color"));
-  r.windowColor = v.toString();
+  r.windowColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("inactive.window.color"));
-  r.inactiveWindowColor = v.toString();
+  r.inactiveWindowColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("base.color"));
-  r.baseColor = v.toString();
+  r.baseColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("inactive.base.color"));
-  r.inactiveBaseColor = v.toString();
+  r.inactiveBaseColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("alt.base.color"));
-  r.altBaseColor = v.toString();
+  r.altBaseColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("inactive.alt.base.color"));
-  r.inactiveAltBaseColor = v.toString();
+  r.inactiveAltBaseColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("button.color"));
-  r.buttonColor = v.toString();
+  r.buttonColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("light.color"));
-  r.lightColor = v.toString();
+  r.lightColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("mid.light.color"));
-  r.midLightColor = v.toString();
+  r.midLightColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("dark.color"));
-  r.darkColor = v.toString();
+  r.darkColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("mid.color"));
-  r.midColor = v.toString();
+  r.midColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("shadow.color"));
   if (v.isValid())
-    r.shadowColor = v.toString();
+    r.shadowColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("highlight.color"));
-  r.highlightColor = v.toString();
+  r.highlightColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("inactive.highlight.color"));
-  r.inactiveHighlightColor = v.toString();
+  r.inactiveHighlightColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("tooltip.base.color"));
-  r.tooltipBaseColor = v.toString();
+  r.tooltipBaseColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("text.color"));
-  r.textColor = v.toString();
+  r.textColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("inactive.text.color"));
-  r.inactiveTextColor = v.toString();
+  r.inactiveTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("window.text.color"));
-  r.windowTextColor = v.toString();
+  r.windowTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("inactive.window.text.color"));
-  r.inactiveWindowTextColor = v.toString();
+  r.inactiveWindowTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("button.text.color"));
-  r.buttonTextColor = v.toString();
+  r.buttonTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("disabled.text.color"));
-  r.disabledTextColor = v.toString();
+  r.disabledTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("tooltip.text.color"));
-  r.tooltipTextColor = v.toString();
+  r.tooltipTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("highlight.text.color"));
-  r.highlightTextColor = v.toString();
+  r.highlightTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("inactive.highlight.text.color"));
-  r.inactiveHighlightTextColor = v.toString();
+  r.inactiveHighlightTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("link.color"));
-  r.linkColor = v.toString();
+  r.linkColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("link.visited.color"));
-  r.linkVisitedColor = v.toString();
+  r.linkVisitedColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("progress.indicator.text.color"));
-  r.progressIndicatorTextColor = v.toString();
+  r.progressIndicatorTextColor = getColor(v);
 
   v = getValue(KSL("GeneralColors"),KSL("progress.inactive.indicator.text.color"));
-  r.progressInactiveIndicatorTextColor = v.toString();
+  r.progressInactiveIndicatorTextColor = getColor(v);
 
   return r;
 }
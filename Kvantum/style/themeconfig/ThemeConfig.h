@@ -20,7 +20,7 @@
 
 #include "themeconfig/specs.h"
 
-class QSettings;
+class QFileInfo;
 
 namespace Kvantum {
 /*
@@ -87,7 +87,17 @@ class ThemeConfig {
      */
     QVariant getValue(const QString &group, const QString& key) const;
 
-    QSettings *settings_;
+#if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
+    /*
+       Reads the values from the compiled cache of the config file
+       if it isn't stale, or writes the cache after parsing it.
+     */
+    bool loadCache(const QString &cacheFile, const QFileInfo &source);
+    void saveCache(const QString &cacheFile, const QFileInfo &source) const;
+#endif
+
+    /* All values of the theme config file, grouped by their sections */
+    QHash<QString, QHash<QString, QVariant> > values_;
     ThemeConfig *parentConfig_;
     /*
        Remember specifications instead of getting them again and again!
@@ -19,6 +19,7 @@
 #define SPEC_H
 
 #include <QStringList>
+#include <QColor>
 #if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
 #include "drag/windowmanager.h"
 #else
@@ -26,6 +27,14 @@
 #endif
 
 namespace Kvantum {
+/* Colors are parsed once, when the theme is loaded, and an invalid
+   color means that the color isn't set. (Qt4 still uses color names.) */
+#if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
+typedef QColor spec_color;
+#else
+typedef QString spec_color;
+#endif
+
 /* Generic information about a theme */
 typedef struct {
   QString author;
@@ -219,38 +228,44 @@ typedef struct {
   int large_icon_size;
   int button_icon_size;
   int toolbar_icon_size;
+
+  /* maximum size of rasterized SVG elements
+     kept by Kvantum (in MiB) */
+  int render_cache_size;
+  /* the frame rate of animations */
+  int animation_fps;
 } theme_spec;
 
 /* General colors */
 typedef struct {
-  QString windowColor;
-  QString inactiveWindowColor;
-  QString baseColor;
-  QString inactiveBaseColor;
-  QString altBaseColor;
-  QString inactiveAltBaseColor;
-  QString buttonColor;
-  QString lightColor;
-  QString midLightColor;
-  QString darkColor;
-  QString midColor;
-  QString shadowColor;
-  QString highlightColor;
-  QString inactiveHighlightColor;
-  QString tooltipBaseColor;
-  QString textColor;
-  QString inactiveTextColor;
-  QString windowTextColor;
-  QString inactiveWindowTextColor;
-  QString buttonTextColor;
-  QString disabledTextColor;
-  QString tooltipTextColor;
-  QString highlightTextColor;
-  QString inactiveHighlightTextColor;
-  QString linkColor;
-  QString linkVisitedColor;
-  QString progressIndicatorTextColor;
-  QString progressInactiveIndicatorTextColor;
+  spec_color windowColor;
+  spec_color inactiveWindowColor;
+  spec_color baseColor;
+  spec_color inactiveBaseColor;
+  spec_color altBaseColor;
+  spec_color inactiveAltBaseColor;
+  spec_color buttonColor;
+  spec_color lightColor;
+  spec_color midLightColor;
+  spec_color darkColor;
+  spec_color midColor;
+  spec_color shadowColor;
+  spec_color highlightColor;
+  spec_color inactiveHighlightColor;
+  spec_color tooltipBaseColor;
+  spec_color textColor;
+  spec_color inactiveTextColor;
+  spec_color windowTextColor;
+  spec_color inactiveWindowTextColor;
+  spec_color buttonTextColor;
+  spec_color disabledTextColor;
+  spec_color tooltipTextColor;
+  spec_color highlightTextColor;
+  spec_color inactiveHighlightTextColor;
+  spec_color linkColor;
+  spec_color linkVisitedColor;
+  spec_color progressIndicatorTextColor;
+  spec_color progressInactiveIndicatorTextColor;
 } color_spec;
 
 /* Hacks */
@@ -317,6 +332,9 @@ typedef struct {
   QString element;
   /* Element name for frame expansion */
   QString expandedElement;
+  /* interned IDs of the element and expanded element
+     (only used internally, -1 if there's no element) */
+  int elementId, expandedElementId;
   /* custom element name of the focus rectangle */
   QString focusRectElement;
   /* has a frame? */
@@ -346,6 +364,8 @@ typedef struct {
 typedef struct {
   /* Element name */
   QString element;
+  /* interned ID of the element (only used internally, -1 if there's none) */
+  int elementId;
   /* has an interior? */
   bool hasInterior;
   /* has a focus interior? */
@@ -360,6 +380,8 @@ typedef struct {
 typedef struct {
   /* Element name */
   QString element;
+  /* interned ID of the element (only used internally, -1 if there's none) */
+  int elementId;
   /* size */
   int size;
 } indicator_spec;
@@ -377,17 +399,17 @@ typedef struct {
 /* Generic information about text and icons (labels) */
 typedef struct {
   /* normal text color */
-  QString normalColor;
-  QString normalInactiveColor;
+  spec_color normalColor;
+  spec_color normalInactiveColor;
   /* focused text color */
-  QString focusColor;
-  QString focusInactiveColor;
+  spec_color focusColor;
+  spec_color focusInactiveColor;
   /* pressed text color */
-  QString pressColor;
-  QString pressInactiveColor;
+  spec_color pressColor;
+  spec_color pressInactiveColor;
   /* toggled text color */
-  QString toggleColor;
-  QString toggleInactiveColor;
+  spec_color toggleColor;
+  spec_color toggleInactiveColor;
   /* use bold font? */
   bool boldFont;
   /* the weight of the bold font (if any) */
@@ -399,8 +421,8 @@ typedef struct {
   /* shadow shift */
   int xshift,yshift;
   /* shadow color */
-  QString shadowColor;
-  QString inactiveShadowColor;
+  spec_color shadowColor;
+  spec_color inactiveShadowColor;
   /* shadow alpha */
   int a;
   /* shadow depth */
@@ -416,6 +438,7 @@ typedef struct {
 /* Fill the specs with their default values */
 
 static inline void default_frame_spec(frame_spec &fspec) {
+  fspec.elementId = fspec.expandedElementId = -1;
   fspec.hasFrame = false;
   fspec.hasFocusFrame = false;
   fspec.top = fspec.bottom = fspec.left = fspec.right = 0;
@@ -427,12 +450,14 @@ static inline void default_frame_spec(frame_spec &fspec) {
 }
 
 static inline void default_interior_spec(interior_spec &ispec) {
+  ispec.elementId = -1;
   ispec.hasInterior = true;
   ispec.hasFocusInterior = false;
   ispec.px = ispec.py = 0;
 }
 
 static inline void default_indicator_spec(indicator_spec &dspec) {
+  dspec.elementId = -1;
   dspec.size = 15;
 }
 
@@ -443,7 +468,7 @@ static inline void default_label_spec(label_spec &lspec) {
   lspec.hasShadow = false;
   lspec.xshift = 0;
   lspec.yshift = 1;
-  lspec.shadowColor = QString("#000000");
+  lspec.shadowColor = spec_color("#000000");
   lspec.a = 255;
   lspec.depth = 1;
   lspec.hasMargin = false;
@@ -543,10 +568,12 @@ static inline void default_theme_spec(theme_spec &tspec) {
   tspec.large_icon_size = 32;
   tspec.button_icon_size = 16;
   tspec.toolbar_icon_size = 22;
+  tspec.render_cache_size = 16;
+  tspec.animation_fps = 25;
 }
 
 static inline void default_color_spec(color_spec &cspec) {
-  cspec.shadowColor = QString("#000000");
+  cspec.shadowColor = spec_color("#000000");
 }
 
 static inline void default_hacks_spec(hacks_spec &hspec) {